@@ -26,6 +26,9 @@ TM1637 module(3, 4);    //  ATtiny85: DIO=3, CLK=4
 
 #define SMALLFONTS_OPT_UPPER 1     // ;-ucase-Z (set to 0 to save 160 bytes)
 #define SMALLFONTS_OPT_LOWER 1     // [-lcase-|
+#define SMALLFONTS_OPT_SUBSET 1    // only the chars of the texts below (saves 180 bytes)
+// The subset is made by the fontsubset tool of the Adafruit_GFX library. Run it again after changing the texts:
+//   fontsubset -x 0123456789 smallfonts5x6.h T85_TM1637_S6xG5_ticker_clock.ino > smallfonts5x6_subset.h
 #include "matrix5x6.h"
 
 
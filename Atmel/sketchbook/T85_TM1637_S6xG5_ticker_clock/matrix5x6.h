@@ -1,4 +1,11 @@
+#if !defined(SMALLFONTS_OPT_SUBSET)
+#define SMALLFONTS_OPT_SUBSET 0    // use the subset made by fontsubset
+#endif
+#if(SMALLFONTS_OPT_SUBSET)
+#include "smallfonts5x6_subset.h"
+#else
 #include "smallfonts5x6.h"
+#endif
 
 #define S6xG5_OPT_MIRROR_SEG true
 
@@ -96,9 +103,20 @@ void drawChar(unsigned char c, int8_t x=0, int8_t y=0, bool fDisplayNow=true)
      ((y + fontheight  - 1) < 0))   // Clip top  (fontheight=6)
       return;
 
+#if(SMALLFONTS_OPT_SUBSET)
+  // the subset only has the glyphs of the chars in use, map c to its glyph
+  if(c < Small_Fonts5x6_FIRST || c > Small_Fonts5x6_LAST)
+    return;
+  uint8_t nGlyph = pgm_read_byte(&Small_Fonts5x6_map[c - Small_Fonts5x6_FIRST]);
+  if(nGlyph == 0xFF)
+    return;
+#else
+  uint8_t nGlyph = c - 32;
+#endif
+
   for(int8_t i=0; i<5; i++ )
   { // Char bitmap = 5 columns
-    uint8_t line = pgm_read_byte(&Small_Fonts5x6[(c-32) * 5 + i]);
+    uint8_t line = pgm_read_byte(&Small_Fonts5x6[nGlyph * 5 + i]);
     for(int8_t j=0; j<8; j++, line >>= 1)
       setPixel(x+i, y+j, line & 1, false);
   }
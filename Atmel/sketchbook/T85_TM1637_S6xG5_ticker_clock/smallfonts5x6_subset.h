@@ -0,0 +1,63 @@
+// Small_Fonts5x6 subset made by fontsubset, 42 of 96 glyphs:
+//  !-./0123456789:ADHIMNTXYabcdeilmnortuvwxy
+
+#define Small_Fonts5x6_FIRST 0x20
+#define Small_Fonts5x6_LAST  0x79
+
+const PROGMEM uint8_t Small_Fonts5x6[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00,   // Code for char space
+        0x00, 0x2F, 0x00, 0x00, 0x00,   // Code for char !
+        0x08, 0x08, 0x08, 0x08, 0x08,   // Code for char -
+        0x00, 0x20, 0x00, 0x00, 0x00,   // Code for char .
+        0x20, 0x18, 0x06, 0x01, 0x00,   // Code for char /
+        0x1E, 0x21, 0x21, 0x1E, 0x00,   // Code for char 0
+        0x00, 0x02, 0x3F, 0x00, 0x00,   // Code for char 1
+        0x32, 0x29, 0x29, 0x26, 0x00,   // Code for char 2
+        0x12, 0x21, 0x25, 0x1A, 0x00,   // Code for char 3
+        0x18, 0x16, 0x3F, 0x10, 0x00,   // Code for char 4
+        0x27, 0x25, 0x25, 0x19, 0x00,   // Code for char 5
+        0x1E, 0x25, 0x25, 0x18, 0x00,   // Code for char 6
+        0x01, 0x39, 0x05, 0x03, 0x00,   // Code for char 7
+        0x1A, 0x25, 0x25, 0x1A, 0x00,   // Code for char 8
+        0x12, 0x25, 0x25, 0x1E, 0x00,   // Code for char 9
+        0x00, 0x24, 0x00, 0x00, 0x00,   // Code for char :
+        0x30, 0x0C, 0x0B, 0x0C, 0x30,   // Code for char A
+        0x3F, 0x21, 0x21, 0x21, 0x1E,   // Code for char D
+        0x3F, 0x04, 0x04, 0x3F, 0x00,   // Code for char H
+        0x00, 0x21, 0x3F, 0x21, 0x00,   // Code for char I
+        0x3F, 0x06, 0x18, 0x06, 0x3F,   // Code for char M
+        0x3F, 0x03, 0x0C, 0x30, 0x3F,   // Code for char N
+        0x01, 0x01, 0x3F, 0x01, 0x01,   // Code for char T
+        0x21, 0x12, 0x0C, 0x12, 0x21,   // Code for char X
+        0x01, 0x02, 0x3C, 0x02, 0x01,   // Code for char Y
+        0x00, 0x12, 0x2A, 0x3C, 0x00,   // Code for char a
+        0x3F, 0x24, 0x24, 0x18, 0x00,   // Code for char b
+        0x00, 0x1C, 0x22, 0x22, 0x00,   // Code for char c
+        0x18, 0x24, 0x24, 0x3F, 0x00,   // Code for char d
+        0x1C, 0x2A, 0x2A, 0x24, 0x00,   // Code for char e
+        0x00, 0x3D, 0x00, 0x00, 0x00,   // Code for char i
+        0x00, 0x1F, 0x20, 0x00, 0x00,   // Code for char l
+        0x3E, 0x02, 0x3E, 0x02, 0x3C,   // Code for char m
+        0x3E, 0x02, 0x02, 0x3C, 0x00,   // Code for char n
+        0x1C, 0x22, 0x22, 0x1C, 0x00,   // Code for char o
+        0x00, 0x3C, 0x02, 0x02, 0x00,   // Code for char r
+        0x00, 0x1F, 0x24, 0x24, 0x00,   // Code for char t
+        0x1E, 0x20, 0x20, 0x3E, 0x00,   // Code for char u
+        0x00, 0x0E, 0x30, 0x0E, 0x00,   // Code for char v
+        0x0E, 0x30, 0x0C, 0x30, 0x0E,   // Code for char w
+        0x22, 0x14, 0x08, 0x14, 0x22,   // Code for char x
+        0x26, 0x28, 0x18, 0x06, 0x00,   // Code for char y
+};
+
+// Glyph index of chars Small_Fonts5x6_FIRST..Small_Fonts5x6_LAST, 0xFF if not in the subset
+const PROGMEM uint8_t Small_Fonts5x6_map[] = {
+  0, 1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 16, 0xFF, 0xFF,
+  17, 0xFF, 0xFF, 0xFF, 18, 19, 0xFF, 0xFF, 0xFF, 20, 21, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 22, 0xFF, 0xFF, 0xFF, 23, 24, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 25, 26, 27, 28, 29, 0xFF, 0xFF,
+  0xFF, 30, 0xFF, 0xFF, 31, 32, 33, 34, 0xFF, 0xFF, 35, 0xFF,
+  36, 37, 38, 39, 40, 41 };
+
+// 300 bytes, 480 for the whole table
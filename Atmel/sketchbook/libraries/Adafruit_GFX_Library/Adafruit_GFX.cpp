@@ -33,34 +33,9 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "Adafruit_GFX.h"
 #include "glcdfont.c"
-#ifdef __AVR__
-  #include <avr/pgmspace.h>
-#elif defined(ESP8266) || defined(ESP32)
-  #include <pgmspace.h>
-#endif
-
-// Many (but maybe not all) non-AVR board installs define macros
-// for compatibility with existing PROGMEM-reading AVR code.
-// Do our own checks and defines here for good measure...
-
-#ifndef pgm_read_byte
- #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
-#endif
-#ifndef pgm_read_word
- #define pgm_read_word(addr) (*(const unsigned short *)(addr))
-#endif
-#ifndef pgm_read_dword
- #define pgm_read_dword(addr) (*(const unsigned long *)(addr))
-#endif
 
-// Pointers are a peculiar case...typically 16-bit on AVR boards,
-// 32 bits elsewhere.  Try to accommodate both...
-
-#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
- #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
-#else
- #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
-#endif
+// PROGMEM access (pgm_read_xxx, GFXflashReader) and gfxBitMask() come from
+// the platform backend, see GFXbackend.h
 
 #ifndef min
 #define min(a,b) (((a) < (b)) ? (a) : (b))
@@ -70,6 +45,31 @@ POSSIBILITY OF SUCH DAMAGE.
 #define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
 #endif
 
+// Glyph index of char c in font, -1 if the font has no glyph for it
+static int16_t glyphIndex(const GFXfont *font, uint8_t c) {
+    uint8_t first = pgm_read_byte(&font->first);
+    if((c < first) || (c > (uint8_t)pgm_read_byte(&font->last))) return -1;
+    c -= first;
+    if(pgm_read_byte(&font->flags) & GFX_FONT_REMAP) { // Subset font
+        c = pgm_read_byte(&((uint8_t *)pgm_read_pointer(&font->map))[c]);
+        if(c == 0xFF) return -1;
+    }
+    return c;
+}
+
+// Copy a PROGMEM glyph to RAM in one pass instead of one read per field
+static void readGlyph(const GFXfont *font, uint8_t c, GFXglyph *g) {
+    GFXflashReader rd((const uint8_t *)
+      &(((GFXglyph *)pgm_read_pointer(&font->glyph))[c]));
+    g->bitmapOffset  = rd.read();
+    g->bitmapOffset |= (uint16_t)rd.read() << 8;
+    g->width         = rd.read();
+    g->height        = rd.read();
+    g->xAdvance      = rd.read();
+    g->xOffset       = rd.read();
+    g->yOffset       = rd.read();
+}
+
 Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h):
 WIDTH(w), HEIGHT(h)
 {
@@ -81,15 +81,39 @@ WIDTH(w), HEIGHT(h)
     textcolor = textbgcolor = 0xFFFF;
     wrap      = true;
     _cp437    = false;
+    _smooth   = false;
     gfxFont   = NULL;
     fontHeight = 8;
     fontDesc  = 0;
+    autoscroll = false;
 }
 
 // Bresenham's algorithm - thx wikpedia
+// Drawn as run slices: each run of pixels on the same row (or column, for
+// steep lines) is written as one fast line instead of pixel by pixel.  The
+// pixels set are the same as with the per-pixel version.
 void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         uint16_t color) {
-    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+    writeLineRuns(x0, y0, x1, y1, 1, color);
+}
+
+// Line of 'thickness' pixels, measured along the minor axis (vertically
+// for lines that are more horizontal than vertical, and vice versa)
+void Adafruit_GFX::drawThickLine(int16_t x0, int16_t y0, int16_t x1,
+        int16_t y1, uint8_t thickness, uint16_t color) {
+    if(!thickness) return;
+    startWrite();
+    writeLineRuns(x0, y0, x1, y1, thickness, color);
+    endWrite();
+}
+
+// Run-slice Bresenham shared by writeLine() and drawThickLine().  Runs are
+// written as fast lines, or as rectangles across the minor axis for thick
+// lines.  The steps that fall outside the display are skipped before
+// drawing, starting the error term where Bresenham would have it.
+void Adafruit_GFX::writeLineRuns(int16_t x0, int16_t y0, int16_t x1,
+        int16_t y1, uint8_t thickness, uint16_t color) {
+    boolean steep = abs(y1 - y0) > abs(x1 - x0);
     if (steep) {
         _swap_int16_t(x0, y0);
         _swap_int16_t(x1, y1);
@@ -100,29 +124,88 @@ void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         _swap_int16_t(y0, y1);
     }
 
-    int16_t dx, dy;
-    dx = x1 - x0;
-    dy = abs(y1 - y0);
-
-    int16_t err = dx / 2;
-    int16_t ystep;
-
-    if (y0 < y1) {
-        ystep = 1;
-    } else {
-        ystep = -1;
+    int16_t dx = x1 - x0,
+            dy = abs(y1 - y0),
+            e0 = dx / 2;                     // Initial Bresenham error
+    int8_t  ystep = (y0 < y1) ? 1 : -1;
+    int16_t tlo = thickness / 2,             // Thickness above/below line
+            thi = thickness - 1 - tlo;
+    int16_t majorMax = (steep ? _height : _width) - 1,
+            minorMax = (steep ? _width : _height) - 1;
+
+    // Clip major axis: k is the step along it, pixel k is at x0+k
+    int16_t k0 = (x0 < 0) ? -x0 : 0,
+            k1 = (x1 > majorMax) ? majorMax - x0 : dx;
+    if(k0 > k1) return;
+
+    if(dy == 0) {
+        // Straight line: the default fast line functions end up here again,
+        // so don't call those for a thin line
+        if((y0 + thi < 0) || (y0 - tlo > minorMax)) return;
+        if(thickness > 1) {
+            if(steep) writeFillRect(y0 - tlo, x0 + k0, thickness, k1 - k0 + 1, color);
+            else      writeFillRect(x0 + k0, y0 - tlo, k1 - k0 + 1, thickness, color);
+        } else {
+            for(int16_t k=k0; k<=k1; k++) {
+                if(steep) writePixel(y0, x0 + k, color);
+                else      writePixel(x0 + k, y0, color);
+            }
+        }
+        return;
     }
 
-    for (; x0<=x1; x0++) {
-        if (steep) {
-            writePixel(y0, x0, color);
+    // Clip minor axis.  After k steps the minor coordinate has moved
+    // n(k) = ceil((k*dy - e0) / dx) pixels; find the steps for which
+    // y0 +/- n(k) (with thickness) is on the display.
+    int16_t nlo = (ystep > 0) ? -thi - y0 : y0 - tlo - minorMax,
+            nhi = (ystep > 0) ? minorMax + tlo - y0 : y0 + thi;
+    if((nhi < 0) || (nlo > dy)) return;
+    if(nlo > 0) {
+        int16_t k = ((int32_t)(nlo - 1) * dx + e0) / dy + 1;
+        if(k > k0) k0 = k;
+    }
+    if(nhi < dy) {
+        int16_t k = ((int32_t)nhi * dx + e0) / dy;
+        if(k < k1) k1 = k;
+    }
+    if(k0 > k1) return;
+
+    // Bresenham state at step k0
+    int16_t n   = k0 ? ((int32_t)k0 * dy - e0 + dx - 1) / dx : 0,
+            err = e0 - (int32_t)k0 * dy + (int32_t)n * dx,
+            y   = y0 + ystep * n;
+
+    // The minor coordinate changes every dx/dy or dx/dy+1 steps.  frac
+    // tracks err modulo dy to pick the run length without dividing.
+    int16_t q    = dx / dy,
+            rem  = dx % dy,
+            run  = err / dy + 1,
+            frac = err % dy,
+            k    = k0;
+    for(;;) {
+        if(run > k1 - k + 1) run = k1 - k + 1;
+        if(thickness > 1) {
+            if(steep) writeFillRect(y - tlo, x0 + k, thickness, run, color);
+            else      writeFillRect(x0 + k, y - tlo, run, thickness, color);
+        } else if(run < 3) {
+            // Short runs are cheaper as pixels than as a fast line call
+            for(int16_t i=k; i<k+run; i++) {
+                if(steep) writePixel(y, x0 + i, color);
+                else      writePixel(x0 + i, y, color);
+            }
         } else {
-            writePixel(x0, y0, color);
+            if(steep) writeFastVLine(y, x0 + k, run, color);
+            else      writeFastHLine(x0 + k, y, run, color);
         }
-        err -= dy;
-        if (err < 0) {
-            y0 += ystep;
-            err += dx;
+        k += run;
+        if(k > k1) break;
+        y    += ystep;
+        frac += rem;
+        if(frac >= dy) {
+            frac -= dy;
+            run   = q + 1;
+        } else {
+            run   = q;
         }
     }
 }
@@ -162,6 +245,18 @@ void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
     fillRect(x,y,w,h,color);
 }
 
+void Adafruit_GFX::writeRGBSpan(int16_t x, int16_t y,
+        const uint16_t *colors, int16_t w) {
+    // Overwrite in subclasses if desired!
+    for(int16_t i=0; i<w; i++) writePixel(x+i, y, colors[i]);
+}
+
+void Adafruit_GFX::writeGraySpan(int16_t x, int16_t y,
+        const uint8_t *colors, int16_t w) {
+    // Overwrite in subclasses if desired!
+    for(int16_t i=0; i<w; i++) writePixel(x+i, y, colors[i]);
+}
+
 void Adafruit_GFX::endWrite(){
     // Overwrite in subclasses if startWrite is defined!
 }
@@ -171,8 +266,12 @@ void Adafruit_GFX::endWrite(){
 void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
         int16_t h, uint16_t color) {
     // Update in subclasses if desired!
+    // Plain pixels, writeLine() calls this for every run of a steep line.
+    // Covers the same pixels as writeLine(x, y, x, y+h-1), also for h < 1.
+    int16_t y1 = y + h - 1;
+    if(y1 < y) _swap_int16_t(y, y1);
     startWrite();
-    writeLine(x, y, x, y+h-1, color);
+    for(; y<=y1; y++) writePixel(x, y, color);
     endWrite();
 }
 
@@ -181,8 +280,12 @@ void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
 void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y,
         int16_t w, uint16_t color) {
     // Update in subclasses if desired!
+    // Plain pixels, writeLine() calls this for every run of a shallow line.
+    // Covers the same pixels as writeLine(x, y, x+w-1, y), also for w < 1.
+    int16_t x1 = x + w - 1;
+    if(x1 < x) _swap_int16_t(x, x1);
     startWrite();
-    writeLine(x, y, x+w-1, y, color);
+    for(; x<=x1; x++) writePixel(x, y, color);
     endWrite();
 }
 
@@ -381,6 +484,13 @@ void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0,
 // Fill a triangle
 void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    fillTriangleSpans(x0, y0, x1, y1, x2, y2, NULL, color, color);
+}
+
+// Scanlines of a filled triangle, plain or with an 8x8 pattern
+void Adafruit_GFX::fillTriangleSpans(int16_t x0, int16_t y0,
+        int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+        const uint8_t *pattern, uint16_t color, uint16_t bg) {
 
     int16_t a, b, y, last;
 
@@ -402,7 +512,8 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         else if(x1 > b) b = x1;
         if(x2 < a)      a = x2;
         else if(x2 > b) b = x2;
-        writeFastHLine(a, y0, b-a+1, color);
+        if(pattern) writeFastHLinePattern(a, y0, b-a+1, pattern, color, bg);
+        else        writeFastHLine(a, y0, b-a+1, color);
         endWrite();
         return;
     }
@@ -437,7 +548,8 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
         */
         if(a > b) _swap_int16_t(a,b);
-        writeFastHLine(a, y, b-a+1, color);
+        if(pattern) writeFastHLinePattern(a, y, b-a+1, pattern, color, bg);
+        else        writeFastHLine(a, y, b-a+1, color);
     }
 
     // For lower part of triangle, find scanline crossings for segments
@@ -454,11 +566,388 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
         b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
         */
         if(a > b) _swap_int16_t(a,b);
-        writeFastHLine(a, y, b-a+1, color);
+        if(pattern) writeFastHLinePattern(a, y, b-a+1, pattern, color, bg);
+        else        writeFastHLine(a, y, b-a+1, color);
+    }
+    endWrite();
+}
+
+// BEZIER CURVES AND ARCS --------------------------------------------------
+
+// Curves are drawn as short lines between points on the curve, using
+// integer math only.  Bezier points come from forward differencing with
+// 2^s steps: with t = i/2^s all terms are scaled by a power of 2^s, so the
+// differences are exact integers and the last point lands exactly on the
+// end point.  The step count adapts to the length of the control polygon.
+// Coordinates should stay within +/-2048 to avoid overflow on 16-bit ints.
+
+// Number of steps (as power of 2) for a control polygon of length len,
+// aiming for lines of about 4 pixels
+static uint8_t curveSteps(int16_t len, uint8_t maxSteps) {
+    uint8_t s = 0;
+    while((s < maxSteps) && ((len >> s) > 4)) s++;
+    return s;
+}
+
+static int16_t chebyshev(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    int16_t dx = abs(x1 - x0), dy = abs(y1 - y0);
+    return (dx > dy) ? dx : dy;
+}
+
+// Draw a quadratic Bezier curve from (x0,y0) to (x2,y2), control point (x1,y1)
+void Adafruit_GFX::drawQuadBezier(int16_t x0, int16_t y0, int16_t x1,
+        int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    uint8_t s = curveSteps(chebyshev(x0, y0, x1, y1) +
+                           chebyshev(x1, y1, x2, y2), 7);
+    int16_t n  = 1 << s;
+    int32_t n2 = (int32_t)n * n;
+
+    // P(t) = a*t^2 + b*t + c, scaled by n^2
+    int32_t ax  = x0 - 2 * x1 + x2, ay = y0 - 2 * y1 + y2,
+            fx  = x0 * n2, fy = y0 * n2,
+            d1x = ax + 2 * (int32_t)(x1 - x0) * n,
+            d1y = ay + 2 * (int32_t)(y1 - y0) * n,
+            d2x = 2 * ax, d2y = 2 * ay,
+            half = n2 >> 1;
+    int16_t px = x0, py = y0;
+
+    startWrite();
+    for(int16_t i=1; i<=n; i++) {
+        fx  += d1x; fy  += d1y;
+        d1x += d2x; d1y += d2y;
+        int16_t x = (fx + half) >> (2 * s), y = (fy + half) >> (2 * s);
+        if((x != px) || (y != py) || (i == n)) {
+            writeLine(px, py, x, y, color);
+            px = x;
+            py = y;
+        }
+    }
+    endWrite();
+}
+
+// Draw a cubic Bezier curve from (x0,y0) to (x3,y3), control points
+// (x1,y1) and (x2,y2)
+void Adafruit_GFX::drawCubicBezier(int16_t x0, int16_t y0, int16_t x1,
+        int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3,
+        uint16_t color) {
+    uint8_t s = curveSteps(chebyshev(x0, y0, x1, y1) +
+                           chebyshev(x1, y1, x2, y2) +
+                           chebyshev(x2, y2, x3, y3), 5);
+    int16_t n  = 1 << s;
+    int32_t n2 = (int32_t)n * n, n3 = n2 * n;
+
+    // P(t) = a*t^3 + b*t^2 + c*t + d, scaled by n^3
+    int32_t ax  = -x0 + 3 * x1 - 3 * x2 + x3, ay = -y0 + 3 * y1 - 3 * y2 + y3,
+            bx  = 3 * x0 - 6 * x1 + 3 * x2,   by = 3 * y0 - 6 * y1 + 3 * y2,
+            cx  = 3 * (x1 - x0),              cy = 3 * (y1 - y0),
+            fx  = x0 * n3,                    fy = y0 * n3,
+            d1x = ax + bx * n + cx * n2,      d1y = ay + by * n + cy * n2,
+            d2x = 6 * ax + 2 * bx * n,        d2y = 6 * ay + 2 * by * n,
+            d3x = 6 * ax,                     d3y = 6 * ay,
+            half = n3 >> 1;
+    int16_t px = x0, py = y0;
+
+    startWrite();
+    for(int16_t i=1; i<=n; i++) {
+        fx  += d1x; fy  += d1y;
+        d1x += d2x; d1y += d2y;
+        d2x += d3x; d2y += d3y;
+        int16_t x = (fx + half) >> (3 * s), y = (fy + half) >> (3 * s);
+        if((x != px) || (y != py) || (i == n)) {
+            writeLine(px, py, x, y, color);
+            px = x;
+            py = y;
+        }
+    }
+    endWrite();
+}
+
+// sin(i * 90/64 degrees) * 16384, for i = 0..64
+static const uint16_t GFXsinTable[65] PROGMEM = {
+        0,   402,   804,  1205,  1606,  2006,  2404,  2801,
+     3196,  3590,  3981,  4370,  4756,  5139,  5520,  5897,
+     6270,  6639,  7005,  7366,  7723,  8076,  8423,  8765,
+     9102,  9434,  9760, 10080, 10394, 10702, 11003, 11297,
+    11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+    13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+    15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+    16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+    16384
+};
+
+// Sine of a (in 1/64 degree) times 16384, linear interpolation in the table
+static int16_t sin64(int32_t a) {
+    int16_t q;
+    boolean neg = false;
+
+    a %= 360L * 64;
+    if(a < 0) a += 360L * 64;
+    if(a >= 180L * 64) {
+        a  -= 180L * 64;
+        neg = true;
+    }
+    q = a;
+    if(q > 90 * 64) q = 180 * 64 - q;      // Mirror second quadrant
+    // Table step is 90 units of 1/64 degree
+    uint8_t i = q / 90, f = q % 90;
+    int16_t v = pgm_read_word(&GFXsinTable[i]);
+    if(f) v += ((int32_t)pgm_read_word(&GFXsinTable[i + 1]) - v) * f / 90;
+    return neg ? -v : v;
+}
+
+// Point at angle a (1/64 degree) on a circle with radius r
+static void arcPoint(int16_t x0, int16_t y0, int16_t r, int32_t a,
+        int16_t *x, int16_t *y) {
+    *x = x0 + (((int32_t)r * sin64(a + 90L * 64) + 8192) >> 14);
+    *y = y0 + (((int32_t)r * sin64(a) + 8192) >> 14);
+}
+
+// Number of segments for an arc, lines of about 4 pixels
+static int16_t arcSegments(int16_t r, int16_t sweep) {
+    int32_t n = ((int32_t)r * sweep) / 229 + 1; // 4 px = 229 degrees*px
+    if(n > 360) n = 360;
+    return n;
+}
+
+// Arc angles are in degrees, 0 is at 3 o'clock and angles run clockwise
+// on the screen.  When end < start the arc passes through 0 degrees.
+static int16_t arcSweep(int16_t start, int16_t end) {
+    int16_t sweep = end - start;
+    if(sweep >= 360) return 360;
+    while(sweep < 0) sweep += 360;
+    return sweep;
+}
+
+// Draw an arc of radius r around (x0,y0) from angle start to end
+void Adafruit_GFX::drawArc(int16_t x0, int16_t y0, int16_t r,
+        int16_t start, int16_t end, uint16_t color) {
+    int16_t sweep = arcSweep(start, end),
+            n     = arcSegments(r, sweep),
+            px, py, x, y;
+
+    arcPoint(x0, y0, r, (int32_t)start * 64, &px, &py);
+    startWrite();
+    for(int16_t i=1; i<=n; i++) {
+        arcPoint(x0, y0, r, (int32_t)start * 64 + (int32_t)sweep * 64 * i / n, &x, &y);
+        writeLine(px, py, x, y, color);
+        px = x;
+        py = y;
+    }
+    endWrite();
+}
+
+// Fill the part of a ring between radius r1 and r2 (r1 < r2) from angle
+// start to end, e.g. the bar of a gauge.  r1 = 0 fills a pie slice.
+void Adafruit_GFX::fillArc(int16_t x0, int16_t y0, int16_t r1, int16_t r2,
+        int16_t start, int16_t end, uint16_t color) {
+    int16_t sweep = arcSweep(start, end),
+            n     = arcSegments(r2, sweep),
+            ix0, iy0, ox0, oy0, ix1, iy1, ox1, oy1;
+
+    arcPoint(x0, y0, r1, (int32_t)start * 64, &ix0, &iy0);
+    arcPoint(x0, y0, r2, (int32_t)start * 64, &ox0, &oy0);
+    for(int16_t i=1; i<=n; i++) {
+        int32_t a = (int32_t)start * 64 + (int32_t)sweep * 64 * i / n;
+        arcPoint(x0, y0, r1, a, &ix1, &iy1);
+        arcPoint(x0, y0, r2, a, &ox1, &oy1);
+        // Each segment of the ring is a quad of two triangles
+        fillTriangle(ix0, iy0, ox0, oy0, ox1, oy1, color);
+        if(r1) fillTriangle(ix0, iy0, ox1, oy1, ix1, iy1, color);
+        ix0 = ix1; iy0 = iy1;
+        ox0 = ox1; oy0 = oy1;
+    }
+}
+
+// PATTERN FILLS -----------------------------------------------------------
+
+// Patterns are 8 bytes, one per row, bit 7 is the leftmost pixel.  They
+// are anchored to the screen (row y & 7, column x & 7), so neighbouring
+// fills line up.  On monochrome displays they give pseudo-gray shades.
+
+// 8x8 Bayer matrix for the ordered dither gray levels
+static const uint8_t GFXbayer8[64] PROGMEM = {
+     0, 32,  8, 40,  2, 34, 10, 42,
+    48, 16, 56, 24, 50, 18, 58, 26,
+    12, 44,  4, 36, 14, 46,  6, 38,
+    60, 28, 52, 20, 62, 30, 54, 22,
+     3, 35, 11, 43,  1, 33,  9, 41,
+    51, 19, 59, 27, 49, 17, 57, 25,
+    15, 47,  7, 39, 13, 45,  5, 37,
+    63, 31, 55, 23, 61, 29, 53, 21
+};
+
+// Pattern for gray level 0..64: the number of pixels set out of 64.  Each
+// level has the pixels of the levels below it, so shades blend smoothly.
+void Adafruit_GFX::grayPattern(uint8_t level, uint8_t pattern[8]) {
+    for(uint8_t y=0; y<8; y++) {
+        uint8_t bits = 0;
+        for(uint8_t x=0; x<8; x++) {
+            bits <<= 1;
+            if(pgm_read_byte(&GFXbayer8[y * 8 + x]) < level) bits |= 1;
+        }
+        pattern[y] = bits;
+    }
+}
+
+// The pattern row is split into runs of equal bits, written with
+// writeFastHLine().  Drivers with a RAM buffer can override this (or
+// fillRectPattern) to apply the pattern bits as byte masks.
+void Adafruit_GFX::writeFastHLinePattern(int16_t x, int16_t y, int16_t w,
+        const uint8_t pattern[8], uint16_t color, uint16_t bg) {
+    uint8_t bits = pattern[y & 7], n;
+    int16_t end  = x + w;
+
+    if(w < 1) return;
+    if((bits == 0xFF) || (!bits && (bg != color))) { // Solid
+        writeFastHLine(x, y, w, bits ? color : bg);
+        return;
+    }
+    if(!bits) return;
+    n    = x & 7;  // Rotate the row so bit 7 is the pixel at x
+    bits = (bits << n) | (bits >> (8 - n));
+    while(x < end) {
+        // A row with both 0 and 1 bits has runs of 7 pixels at most
+        uint8_t on = bits & 0x80;
+        for(n=1; (n < 8) && (x + n < end) &&
+          (!((uint8_t)(bits << n) & 0x80) == !on); n++);
+        if(on || (bg != color)) writeFastHLine(x, y, n, on ? color : bg);
+        x   += n;
+        bits = (bits << n) | (bits >> (8 - n));
+    }
+}
+
+void Adafruit_GFX::fillRectPattern(int16_t x, int16_t y, int16_t w,
+        int16_t h, const uint8_t pattern[8], uint16_t color, uint16_t bg) {
+    if(y < 0) {
+        h += y;
+        y  = 0;
+    }
+    if(y + h > _height) h = _height - y;
+    startWrite();
+    for(int16_t i=y; i<y+h; i++) {
+        writeFastHLinePattern(x, i, w, pattern, color, bg);
     }
     endWrite();
 }
 
+// Same circle as fillCircle(), drawn as horizontal spans; every row is
+// drawn once
+void Adafruit_GFX::fillCirclePattern(int16_t x0, int16_t y0, int16_t r,
+        const uint8_t pattern[8], uint16_t color, uint16_t bg) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t px    = x;
+    int16_t py    = y;
+
+    startWrite();
+    writeFastHLinePattern(x0 - r, y0, 2 * r + 1, pattern, color, bg);
+    while(x < y) {
+        if(f >= 0) {
+            y--;
+            ddF_y += 2;
+            f     += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f     += ddF_x;
+        if(x < y + 1) {
+            writeFastHLinePattern(x0 - y, y0 - x, 2 * y + 1, pattern, color, bg);
+            writeFastHLinePattern(x0 - y, y0 + x, 2 * y + 1, pattern, color, bg);
+        }
+        if(y != py) {
+            writeFastHLinePattern(x0 - px, y0 - py, 2 * px + 1, pattern, color, bg);
+            writeFastHLinePattern(x0 - px, y0 + py, 2 * px + 1, pattern, color, bg);
+            py = y;
+        }
+        px = x;
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::fillTrianglePattern(int16_t x0, int16_t y0,
+        int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+        const uint8_t pattern[8], uint16_t color, uint16_t bg) {
+    fillTriangleSpans(x0, y0, x1, y1, x2, y2, pattern, color, bg);
+}
+
+// FLOOD FILL --------------------------------------------------------------
+
+// Scanline seed fill (Heckbert, Graphics Gems I).  Each stack entry is a
+// span on row y that was just filled; the row y+dy next to it still has to
+// be searched.  getPixel() is only used to find the ends of spans, which
+// are written with writeFastHLine().  The stack has a fixed size, so there
+// is no recursion: when it is full, further spans are dropped and the fill
+// is incomplete, which floodFill() reports by returning false.
+struct GFXfillSpan {
+    int16_t y, xl, xr;
+    int8_t  dy;
+};
+
+boolean Adafruit_GFX::floodFill(int16_t x, int16_t y, uint16_t color) {
+    GFXfillSpan stack[GFX_FLOODFILL_STACK];
+    uint16_t    sp = 0;
+    boolean     complete = true;
+    int16_t     l, x1, x2, dy;
+    uint16_t    old;
+
+    if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return true;
+    old = getPixel(x, y);
+
+    // Compare with the value the display stores for color (eg. 1 for 0xFFFF
+    // on a 1-bit canvas), else filled pixels still read as old and every
+    // span is filled again.  The seed pixel is put back, the fill finds it.
+    drawPixel(x, y, color);
+    color = getPixel(x, y);
+    if(old == color) return true;
+    drawPixel(x, y, old);
+
+#define GFX_FILL_PUSH(Y, XL, XR, DY) do {                                  \
+    if(((Y) + (DY) >= 0) && ((Y) + (DY) < _height)) {                       \
+        if(sp < GFX_FLOODFILL_STACK) {                                      \
+            stack[sp].y  = (Y);  stack[sp].xl = (XL);                       \
+            stack[sp].xr = (XR); stack[sp].dy = (DY); sp++;                 \
+        } else complete = false;                                            \
+    } } while(0)
+
+    GFX_FILL_PUSH(y, x, x, 1);      // Row below the seed
+    GFX_FILL_PUSH(y + 1, x, x, -1); // Seed row, popped first
+
+    startWrite();
+    while(sp) {
+        sp--;
+        dy = stack[sp].dy;
+        y  = stack[sp].y + dy;
+        x1 = stack[sp].xl;
+        x2 = stack[sp].xr;
+
+        // Span x1..x2 of row y-dy was filled, search row y beside it.
+        // l is the start of the next span to fill, x the pixel to check.
+        for(x=x1; (x >= 0) && (getPixel(x, y) == old); x--);
+        l = x + 1;
+        if(l < x1) GFX_FILL_PUSH(y, l, x1 - 1, -dy); // Leak on the left
+        if(l > x1) {
+            for(x=x1+1; (x <= x2) && (getPixel(x, y) != old); x++);
+            l = x;
+        } else {
+            x = x1 + 1;
+        }
+        while(l <= x2) {
+            for(; (x < _width) && (getPixel(x, y) == old); x++);
+            writeFastHLine(l, y, x - l, color);
+            GFX_FILL_PUSH(y, l, x - 1, dy);
+            if(x > x2 + 1) GFX_FILL_PUSH(y, x2 + 1, x - 1, -dy); // Right leak
+            for(x++; (x <= x2) && (getPixel(x, y) != old); x++);
+            l = x;
+        }
+    }
+    endWrite();
+#undef GFX_FILL_PUSH
+    return complete;
+}
+
 // BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
 
 // Draw a PROGMEM-resident 1-bit image at the specified (x,y) position,
@@ -466,14 +955,14 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0,
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
 
-    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+    GFXflashReader rd(bitmap); // Rows are read in order, pad bytes too
     uint8_t byte = 0;
 
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++) {
             if(i & 7) byte <<= 1;
-            else      byte   = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            else      byte   = rd.read();
             if(byte & 0x80) writePixel(x+i, y, color);
         }
     }
@@ -487,14 +976,14 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h,
   uint16_t color, uint16_t bg) {
 
-    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+    GFXflashReader rd(bitmap); // Rows are read in order, pad bytes too
     uint8_t byte = 0;
 
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++ ) {
             if(i & 7) byte <<= 1;
-            else      byte   = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            else      byte   = rd.read();
             writePixel(x+i, y, (byte & 0x80) ? color : bg);
         }
     }
@@ -548,14 +1037,14 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
 void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y,
   const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
 
-    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+    GFXflashReader rd(bitmap); // Rows are read in order, pad bytes too
     uint8_t byte = 0;
 
     startWrite();
     for(int16_t j=0; j<h; j++, y++) {
         for(int16_t i=0; i<w; i++ ) {
             if(i & 7) byte >>= 1;
-            else      byte   = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            else      byte   = rd.read();
             // Nearly identical to drawBitmap(), only the bit order
             // is reversed here (left-to-right = LSB to MSB):
             if(byte & 0x01) writePixel(x+i, y, color);
@@ -706,8 +1195,269 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y,
     endWrite();
 }
 
+// Pixels in PROGMEM are copied to RAM in chunks of this many for the spans
+#define GFX_RLE_CHUNK 16
+
+// Shared by the RLE mask blits.  Each row of the mask holds alternately
+// the length of a transparent and of an opaque run, starting with a
+// transparent one (maybe 0), until the runs add up to w.  Longer runs are
+// split with a 0 run of the other kind, eg. 255, 0, 45 for 300 transparent
+// pixels.  Transparent runs are skipped, opaque runs are drawn as spans.
+static void drawRLEMasked(Adafruit_GFX *gfx, int16_t x, int16_t y,
+  const void *bitmap, const uint8_t *mask, int16_t w, int16_t h,
+  boolean pgm, boolean rgb) {
+    const uint8_t  *gray  = (const uint8_t *)bitmap;
+    const uint16_t *color = (const uint16_t *)bitmap;
+    uint16_t buf[GFX_RLE_CHUNK];
+    uint8_t *buf8 = (uint8_t *)buf;
+    int16_t  i, n, k;
+    boolean  show;
+
+    gfx->startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+        show = (y >= 0) && (y < gfx->height());
+        for(i=0; ; ) {
+            i += pgm ? pgm_read_byte(mask++) : *mask++;   // Transparent
+            if(i >= w) break;
+            n  = pgm ? pgm_read_byte(mask++) : *mask++;   // Opaque
+            if(n > w - i) n = w - i;
+            for(k=0; show && (k<n); k+=GFX_RLE_CHUNK) {
+                int16_t c = min(n - k, GFX_RLE_CHUNK);
+                int32_t p = (int32_t)j * w + i + k;
+                if(!pgm) {
+                    if(rgb) gfx->writeRGBSpan(x+i+k, y, &color[p], c);
+                    else    gfx->writeGraySpan(x+i+k, y, &gray[p], c);
+                    continue;
+                }
+                for(int16_t m=0; m<c; m++) {
+                    if(rgb) buf[m]  = pgm_read_word(&color[p + m]);
+                    else    buf8[m] = pgm_read_byte(&gray[p + m]);
+                }
+                if(rgb) gfx->writeRGBSpan(x+i+k, y, buf, c);
+                else    gfx->writeGraySpan(x+i+k, y, buf8, c);
+            }
+            if((i += n) >= w) break;
+        }
+    }
+    gfx->endWrite();
+}
+
+// Draw a PROGMEM-resident 8-bit image (grayscale) with a run length mask
+// at the specified (x,y) position.  BOTH buffers must be PROGMEM-resident.
+void Adafruit_GFX::drawGrayscaleBitmapRLE(int16_t x, int16_t y,
+  const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h) {
+    drawRLEMasked(this, x, y, bitmap, mask, w, h, true, false);
+}
+
+// Draw a RAM-resident 8-bit image (grayscale) with a run length mask
+// at the specified (x,y) position.  BOTH buffers must be RAM-resident.
+void Adafruit_GFX::drawGrayscaleBitmapRLE(int16_t x, int16_t y,
+  uint8_t *bitmap, uint8_t *mask, int16_t w, int16_t h) {
+    drawRLEMasked(this, x, y, bitmap, mask, w, h, false, false);
+}
+
+// Draw a PROGMEM-resident 16-bit image (RGB 5/6/5) with a run length mask
+// at the specified (x,y) position.  BOTH buffers must be PROGMEM-resident.
+void Adafruit_GFX::drawRGBBitmapRLE(int16_t x, int16_t y,
+  const uint16_t bitmap[], const uint8_t mask[], int16_t w, int16_t h) {
+    drawRLEMasked(this, x, y, bitmap, mask, w, h, true, true);
+}
+
+// Draw a RAM-resident 16-bit image (RGB 5/6/5) with a run length mask
+// at the specified (x,y) position.  BOTH buffers must be RAM-resident.
+void Adafruit_GFX::drawRGBBitmapRLE(int16_t x, int16_t y,
+  uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h) {
+    drawRLEMasked(this, x, y, bitmap, mask, w, h, false, true);
+}
+
+// AFFINE (ROTATED AND SCALED) BITMAPS -------------------------------------
+
+// Every target pixel in the bounding box of the rotated bitmap is mapped
+// back into the source with 16.16 fixed point coordinates.  Along a row the
+// source position just steps by a constant, so there is no multiplication
+// per pixel.  Pixels of equal color are collected into runs and written with
+// writeFastHLine().  Bitmap sizes and offsets should stay within +/-2048.
+struct GFXaffineSrc {
+    const uint8_t *bitmap;  // 1-bit source, or NULL for a canvas
+    Adafruit_GFX  *canvas;
+    int16_t        w, h;
+    boolean        progmem;
+    uint16_t       color, bg; // For a canvas, bg is the transparent color
+};
+
+// Color of source pixel (u,v), or -1 to leave the target pixel as it is
+static int32_t affineSample(const GFXaffineSrc *src, int16_t u, int16_t v) {
+    if(!src->bitmap) {
+        uint16_t c = src->canvas->getPixel(u, v);
+        return (c == src->bg) ? -1 : c;
+    }
+    const uint8_t *p = &src->bitmap[v * ((src->w + 7) / 8) + u / 8];
+    if((src->progmem ? pgm_read_byte(p) : *p) & gfxBitMask(u & 7))
+        return src->color;
+    return (src->bg != src->color) ? src->bg : -1;
+}
+
+static void affineBlit(Adafruit_GFX *gfx, const GFXaffineSrc *src,
+        int16_t x, int16_t y, int16_t px, int16_t py, int16_t angle,
+        uint16_t scale) {
+    if(!scale || (src->w <= 0) || (src->h <= 0)) return;
+
+    int32_t c = sin64((int32_t)angle * 64 + 90L * 64), // cos * 16384
+            s = sin64((int32_t)angle * 64);
+
+    // Bounding box: forward map the bitmap corners around the pivot
+    int16_t bx0 = 0x7FFF, by0 = 0x7FFF, bx1 = -0x7FFF, by1 = -0x7FFF;
+    for(uint8_t i=0; i<4; i++) {
+        int32_t cx = ((i & 1) ? src->w : 0) - px,
+                cy = ((i & 2) ? src->h : 0) - py,
+                rx = ((c * cx - s * cy) >> 14) * (int32_t)scale / 256,
+                ry = ((s * cx + c * cy) >> 14) * (int32_t)scale / 256;
+        if(rx < bx0) bx0 = rx;
+        if(rx > bx1) bx1 = rx;
+        if(ry < by0) by0 = ry;
+        if(ry > by1) by1 = ry;
+    }
+    bx0 += x - 1; bx1 += x + 1; // Margin for rounding
+    by0 += y - 1; by1 += y + 1;
+    if(bx0 < 0) bx0 = 0;
+    if(by0 < 0) by0 = 0;
+    if(bx1 >= gfx->width())  bx1 = gfx->width()  - 1;
+    if(by1 >= gfx->height()) by1 = gfx->height() - 1;
+    if((bx0 > bx1) || (by0 > by1)) return;
+
+    // Inverse mapping: rotate back and divide by the scale, in 16.16
+    int32_t  ux = c * 1024 / scale, vx = -s * 1024 / scale, // Per target x
+             uy = s * 1024 / scale, vy =  c * 1024 / scale, // Per target y
+             u0 = ((int32_t)px << 16) + 0x8000 + ux * (bx0 - x) + uy * (by0 - y),
+             v0 = ((int32_t)py << 16) + 0x8000 + vx * (bx0 - x) + vy * (by0 - y);
+    uint32_t uw = (uint32_t)src->w << 16,
+             vh = (uint32_t)src->h << 16;
+
+    gfx->startWrite();
+    for(int16_t ty=by0; ty<=by1; ty++, u0 += uy, v0 += vy) {
+        int32_t u = u0, v = v0, run = -1;
+        int16_t runX = bx0;
+        for(int16_t tx=bx0; tx<=bx1; tx++, u += ux, v += vx) {
+            int32_t col = -1;
+            // Negative coordinates wrap to large unsigned values
+            if(((uint32_t)u < uw) && ((uint32_t)v < vh))
+                col = affineSample(src, u >> 16, v >> 16);
+            if(col != run) {
+                if(run >= 0) gfx->writeFastHLine(runX, ty, tx - runX, run);
+                run  = col;
+                runX = tx;
+            }
+        }
+        if(run >= 0) gfx->writeFastHLine(runX, ty, bx1 + 1 - runX, run);
+    }
+    gfx->endWrite();
+}
+
+// Draw a PROGMEM-resident 1-bit image rotated and scaled around px,py
+void Adafruit_GFX::drawBitmapRotated(int16_t x, int16_t y,
+  const uint8_t bitmap[], int16_t w, int16_t h, int16_t px, int16_t py,
+  int16_t angle, uint16_t scale, uint16_t color, uint16_t bg) {
+    GFXaffineSrc src = { bitmap, NULL, w, h, true, color, bg };
+    affineBlit(this, &src, x, y, px, py, angle, scale);
+}
+
+// Same for a RAM-resident 1-bit image, e.g. the buffer of a GFXcanvas1
+void Adafruit_GFX::drawBitmapRotated(int16_t x, int16_t y,
+  uint8_t *bitmap, int16_t w, int16_t h, int16_t px, int16_t py,
+  int16_t angle, uint16_t scale, uint16_t color, uint16_t bg) {
+    GFXaffineSrc src = { bitmap, NULL, w, h, false, color, bg };
+    affineBlit(this, &src, x, y, px, py, angle, scale);
+}
+
+// Draw the pixels of another GFX object (a canvas) rotated and scaled,
+// read with getPixel().  Pixels with the transparent color are skipped.
+void Adafruit_GFX::drawCanvasRotated(int16_t x, int16_t y,
+  Adafruit_GFX *canvas, int16_t px, int16_t py, int16_t angle,
+  uint16_t scale, uint16_t transparent) {
+    GFXaffineSrc src = { NULL, canvas, canvas->width(), canvas->height(),
+      false, 0, transparent };
+    affineBlit(this, &src, x, y, px, py, angle, scale);
+}
+
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
+// Draw columns x0 to x1 - 1 of row y of a glyph whose top left corner is
+// at gx,gy on screen
+static void glyphRun(Adafruit_GFX *gfx, int16_t gx, int16_t gy, int16_t x0,
+  int16_t x1, int16_t y, uint8_t size, uint16_t color) {
+    if(size == 1) gfx->writeFastHLine(gx + x0, gy + y, x1 - x0, color);
+    else gfx->writeFillRect(gx + x0 * size, gy + y * size,
+           (x1 - x0) * size, size, color);
+}
+
+// Smooth text scaling (setTextSmooth()).  Glyphs of up to GFX_SMOOTH_W x
+// GFX_SMOOTH_H pixels are upsampled with the EPX (Scale2x) rule: a scaled
+// pixel is split in four quadrants, and a quadrant takes the color of its
+// two outer neighbours when they match each other and the other two
+// neighbours don't.  Diagonal edges get their corners cut or filled
+// instead of a staircase of size x size blocks.  Quadrants are size / 2
+// and size - size / 2 pixels, so odd sizes work too.  A glyph row is
+// processed as a whole, bit x of a row being column x.
+#define GFX_SMOOTH_W 16
+#define GFX_SMOOTH_H 32
+
+// Move bits 0-15 to the even bits 0-30
+static uint32_t smoothSpread(uint32_t v) {
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    return (v | (v << 1)) & 0x55555555;
+}
+
+// Draw the n quadrants of bits as spans of height h at gx,y, the clear
+// ones in bg unless bg == color
+static void smoothRow(Adafruit_GFX *gfx, int16_t gx, int16_t y,
+  uint32_t bits, uint8_t n, uint8_t size, uint8_t h, uint16_t color,
+  uint16_t bg) {
+    uint8_t a = size / 2, k, k0 = 0;
+    boolean on = bits & 1, b;
+
+    for(k=1; k<=n; k++) {
+        b = (k < n) && ((bits >> k) & 1);
+        if((k < n) && (b == on)) continue;
+        if(on || (bg != color)) {
+            int16_t x0 = (k0 >> 1) * size + ((k0 & 1) ? a : 0),
+                    x1 = (k  >> 1) * size + ((k  & 1) ? a : 0);
+            gfx->writeFillRect(gx + x0, y, x1 - x0, h, on ? color : bg);
+        }
+        k0 = k;
+        on = b;
+    }
+}
+
+static void drawSmoothGlyph(Adafruit_GFX *gfx, int16_t gx, int16_t gy,
+  const uint16_t *rows, uint8_t w, uint8_t h, uint8_t size, uint16_t color,
+  uint16_t bg) {
+    uint8_t  a = size / 2, r;
+    uint32_t m = ((uint32_t)1 << w) - 1, P, A, B, C, D, E, q1, q2, q3, q4;
+
+    for(r=0; r<h; r++, gy += size) {
+        P = rows[r];                       // Pixels, and their neighbours:
+        A = r ? rows[r - 1] : 0;           // above
+        D = (r + 1 < h) ? rows[r + 1] : 0; // below
+        C = (P << 1) & m;                  // left
+        B = P >> 1;                        // right
+        if(!(P | A | D) && (bg == color)) continue;
+        E  = ~(C ^ A) & (C ^ D) & (A ^ B);   // Top left quadrant
+        q1 = (P & ~E) | (A & E);
+        E  = ~(A ^ B) & (A ^ C) & (B ^ D);   // Top right
+        q2 = (P & ~E) | (B & E);
+        E  = ~(D ^ C) & (D ^ B) & (C ^ A);   // Bottom left
+        q3 = (P & ~E) | (C & E);
+        E  = ~(B ^ D) & (B ^ A) & (D ^ C);   // Bottom right
+        q4 = (P & ~E) | (D & E);
+        smoothRow(gfx, gx, gy, smoothSpread(q1) | (smoothSpread(q2) << 1),
+          2 * w, size, a, color, bg);
+        smoothRow(gfx, gx, gy + a, smoothSpread(q3) | (smoothSpread(q4) << 1),
+          2 * w, size, size - a, color, bg);
+    }
+}
+
 // Draw a character
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
   uint16_t color, uint16_t bg, uint8_t size) {
@@ -722,9 +1472,21 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 
         if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
 
+        GFXflashReader rd(&font[c * 5]);
         startWrite();
+        if(_smooth && (size > 1)) { // Columns to rows, 6th column is blank
+            uint16_t rows[8] = { 0 };
+            for(int8_t i=0; i<5; i++ ) {
+                uint8_t line = rd.read();
+                for(int8_t j=0; j<8; j++, line >>= 1)
+                    if(line & 1) rows[j] |= 1 << i;
+            }
+            drawSmoothGlyph(this, x, y, rows, 6, 8, size, color, bg);
+            endWrite();
+            return;
+        }
         for(int8_t i=0; i<5; i++ ) { // Char bitmap = 5 columns
-            uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+            uint8_t line = rd.read();
             for(int8_t j=0; j<8; j++, line >>= 1) {
                 if(line & 1) {
                     if(size == 1)
@@ -751,15 +1513,17 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         // newlines, returns, non-printable characters, etc.  Calling
         // drawChar() directly with 'bad' characters of font may cause mayhem!
 
-        c -= (uint8_t)pgm_read_byte(&gfxFont->first);
-        GFXglyph *glyph  = &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
+        int16_t  gi = glyphIndex(gfxFont, c);
+        if(gi < 0) return;
+        GFXglyph glyph;
+        readGlyph(gfxFont, gi, &glyph);
         uint8_t  *bitmap = (uint8_t *)pgm_read_pointer(&gfxFont->bitmap);
 
-        uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
-        uint8_t  w  = pgm_read_byte(&glyph->width),
-                 h  = pgm_read_byte(&glyph->height);
-        int8_t   xo = pgm_read_byte(&glyph->xOffset),
-                 yo = pgm_read_byte(&glyph->yOffset);
+        GFXflashReader rd(&bitmap[glyph.bitmapOffset]);
+        uint8_t  w  = glyph.width,
+                 h  = glyph.height;
+        int8_t   xo = glyph.xOffset,
+                 yo = glyph.yOffset;
         uint8_t  xx, yy, bits = 0, bit = 0;
         int16_t  xo16 = 0, yo16 = 0;
 
@@ -768,7 +1532,19 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
             yo16 = yo;
         }
 
-        // Todo: Add character clipping here
+        // Clip to the screen.  Glyphs entirely outside are skipped, and only
+        // the rows and columns inside are decoded: the bit cursor is moved
+        // past invisible rows (and columns) instead of reading their bits.
+        int16_t gx = x + xo * size, gy = y + yo * size;
+        if((gx >= _width) || (gy >= _height) ||
+           (gx + w * size <= 0) || (gy + h * size <= 0)) return;
+        int16_t  x1 = (_width  - gx + size - 1) / size,
+                 y1 = (_height - gy + size - 1) / size;
+        uint8_t  x0 = (gx < 0) ? -gx / size : 0,
+                 y0 = (gy < 0) ? -gy / size : 0;
+        if(x1 > w) x1 = w;
+        if(y1 > h) y1 = h;
+        boolean  clipX = (x0 > 0) || (x1 < w);
 
         // NOTE: THERE IS NO 'BACKGROUND' COLOR OPTION ON CUSTOM FONTS.
         // THIS IS ON PURPOSE AND BY DESIGN.  The background color feature
@@ -787,10 +1563,69 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         // implemented this yet.
 
         startWrite();
-        for(yy=0; yy<h; yy++) {
-            for(xx=0; xx<w; xx++) {
+        if(_smooth && (size > 1) && (w <= GFX_SMOOTH_W) &&
+           (h <= GFX_SMOOTH_H)) {
+            // Whole glyph to rows, rows of row aligned fonts start a byte
+            uint16_t rows[GFX_SMOOTH_H];
+            boolean  aligned = pgm_read_byte(&gfxFont->flags) &
+                               GFX_FONT_ROWALIGNED;
+            for(yy=0; yy<h; yy++) {
+                if(aligned) bit = 0;
+                for(xx=0, rows[yy]=0; xx<w; xx++, bits <<= 1) {
+                    if(!(bit++ & 7)) bits = rd.read();
+                    if(bits & 0x80) rows[yy] |= 1 << xx;
+                }
+            }
+            drawSmoothGlyph(this, gx, gy, rows, w, h, size, color, color);
+            endWrite();
+            return;
+        }
+        if(pgm_read_byte(&gfxFont->flags) & GFX_FONT_ROWALIGNED) {
+            // Each row starts on a byte boundary, so a row is read as whole
+            // bytes and drawn as runs.  Edges are found a byte at a time, an
+            // empty byte outside a run or a full one inside costs one test.
+            uint8_t stride = (w + 7) / 8;
+            int16_t col, run;
+            for(yy=y0; yy<y1; yy++) {
+                if(clipX || (yy == y0))
+                    rd.seek(&bitmap[glyph.bitmapOffset + yy * stride + x0 / 8]);
+                for(col=x0 & ~7, run=-1; col<x1; col+=8) {
+                    bits = rd.read();
+                    if(col < x0)     bits &= 0xFF >> (x0 - col);
+                    if(col + 8 > x1) bits &= 0xFF << (col + 8 - x1);
+                    for(bit=0; ; ) {
+                        // Skip to the next edge: the first set bit, or the
+                        // first clear bit inside a run
+                        uint8_t e = (run < 0) ? bits : ~bits, n = 0;
+                        if(!e) break;
+                        if(!(e & 0xF0)) { n  = 4; e <<= 4; }
+                        if(!(e & 0xC0)) { n += 2; e <<= 2; }
+                        if(!(e & 0x80))   n++;
+                        if((bit += n) >= 8) break;
+                        bits <<= n;
+                        if(run < 0) {
+                            run = col + bit;
+                        } else {
+                            glyphRun(this, gx, gy, run, col + bit, yy, size,
+                              color);
+                            run = -1;
+                        }
+                    }
+                }
+                if(run >= 0) glyphRun(this, gx, gy, run, x1, yy, size, color);
+            }
+            endWrite();
+            return;
+        }
+        for(yy=y0; yy<y1; yy++) {
+            if(clipX || (yy == y0)) { // Move to the first visible bit
+                uint16_t pos = (uint16_t)yy * w + x0;
+                rd.seek(&bitmap[glyph.bitmapOffset + (pos >> 3)]);
+                if((bit = pos & 7)) bits = rd.read() << bit;
+            }
+            for(xx=x0; xx<x1; xx++) {
                 if(!(bit++ & 7)) {
-                    bits = pgm_read_byte(&bitmap[bo++]);
+                    bits = rd.read();
                 }
                 if(bits & 0x80) {
                     if(size == 1) {
@@ -864,14 +1699,14 @@ void Adafruit_GFX::write(uint8_t c) {
             cursor_y += (int16_t)textsize *
                         (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
         } else if(c != '\r') {
-            uint8_t first = pgm_read_byte(&gfxFont->first);
-            if((c >= first) && (c <= (uint8_t)pgm_read_byte(&gfxFont->last))) {
-                GFXglyph *glyph = &(((GFXglyph *)pgm_read_pointer(
-                  &gfxFont->glyph))[c - first]);
-                uint8_t   w     = pgm_read_byte(&glyph->width),
-                          h     = pgm_read_byte(&glyph->height);
+            int16_t gi = glyphIndex(gfxFont, c);
+            if(gi >= 0) {
+                GFXglyph glyph;
+                readGlyph(gfxFont, gi, &glyph);
+                uint8_t   w     = glyph.width,
+                          h     = glyph.height;
                 if((w > 0) && (h > 0)) { // Is there an associated bitmap?
-                    int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset); // sic
+                    int16_t xo = glyph.xOffset; // sic
                     checkScrollWrap(textsize * (xo + w));
                     // if(wrap && ((cursor_x + textsize * (xo + w)) > _width)) {
                     //     cursor_x  = 0;
@@ -880,7 +1715,7 @@ void Adafruit_GFX::write(uint8_t c) {
                     // }
                     drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
                 }
-                cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize;
+                cursor_x += glyph.xAdvance * (int16_t)textsize;
             }
         }
 
@@ -890,6 +1725,56 @@ void Adafruit_GFX::write(uint8_t c) {
 #endif
 }
 
+// Powers of ten for printFixed(), digits are found by subtraction
+static const uint32_t GFXpow10[10] PROGMEM = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Print value / 10^decimals with 'decimals' digits after the point, e.g.
+// printFixed(2350, 2) prints "23.50" and printFixed(-5, 1) prints "-0.5".
+// Pads to 'width' characters with spaces, or with zeros after the sign if
+// zeroPad is set.  Characters go straight to write(): no float math, no
+// division and no string buffer.  Returns the number of characters printed.
+size_t Adafruit_GFX::printFixed(int32_t value, uint8_t decimals,
+        uint8_t width, boolean zeroPad) {
+    uint32_t v = (value < 0) ? -(uint32_t)value : value;
+    uint8_t  digits = 1, len;
+    size_t   n = 0;
+
+    if(decimals > 9) decimals = 9;
+    while((digits < 10) && (v >= pgm_read_dword(&GFXpow10[digits]))) digits++;
+    if(digits <= decimals) digits = decimals + 1; // Leading "0."
+    len = digits + (decimals ? 1 : 0) + ((value < 0) ? 1 : 0);
+    if(width > len) {
+        if(zeroPad) {
+            digits += width - len;
+        } else {
+            for(; len < width; len++, n++) write(' ');
+        }
+    }
+
+    if(value < 0) {
+        write('-');
+        n++;
+    }
+    for(int16_t i=digits-1; i>=0; i--, n++) {
+        char c = '0';
+        if(i < 10) {
+            uint32_t p = pgm_read_dword(&GFXpow10[i]);
+            while(v >= p) {
+                v -= p;
+                c++;
+            }
+        }
+        write(c);
+        if(i && (i == decimals)) {
+            write('.');
+            n++;
+        }
+    }
+    return n;
+}
+
 void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
     cursor_x = x;
     cursor_y = y;
@@ -957,6 +1842,13 @@ void Adafruit_GFX::cp437(boolean x) {
     _cp437 = x;
 }
 
+// Scale text (textsize 2 and up) with edge smoothing instead of square
+// blocks, for large digits from a small font.  Custom font glyphs larger
+// than GFX_SMOOTH_W x GFX_SMOOTH_H are still drawn as blocks.
+void Adafruit_GFX::setTextSmooth(boolean s) {
+    _smooth = s;
+}
+
 void Adafruit_GFX::setFont(const GFXfont *f) {
     if(f) {            // Font struct pointer passed in?
         if(!gfxFont) { // And no current font struct?
@@ -964,10 +1856,6 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
             // Move cursor pos down 6 pixels so it's on baseline.
             cursor_y += 6;
         }
-    } else if(gfxFont) { // NULL passed.  Current font struct defined?
-        // Switching from new to classic font behavior.
-        // Move cursor pos up 6 pixels so it's at top-left of char.
-        //cursor_y -= 6;
         // calculate max descender ("j" or "g")
         fontDesc = 0;
 
@@ -977,8 +1865,13 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
             GFXglyph *glyph;
             uint8_t gh;
             int8_t  yo;
+            int16_t gi = glyphIndex(f, i);
 
-            glyph = &(((GFXglyph *)pgm_read_pointer(&f->glyph))[i-first]);
+            if (gi < 0) {
+                if (i == 0xFF) break;
+                continue;
+            }
+            glyph = &(((GFXglyph *)pgm_read_pointer(&f->glyph))[gi]);
 
             gh = (uint8_t) pgm_read_byte(&glyph->height);
             yo = (int8_t) pgm_read_byte(&glyph->yOffset);
@@ -986,21 +1879,21 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
             if (gh + yo > fontDesc) {
                 fontDesc = gh + yo;
             }
+            if (i == 0xFF) break;
         }
 
         fontHeight = (int16_t) pgm_read_byte(&f->yAdvance);
-      }
-      else {
+    } else {
         if(gfxFont) { // NULL passed.  Current font struct defined?
-          // Switching from new to classic font behavior.
-          // Move cursor pos up 6 pixels so it's at top-left of char.
-          cursor_y -= 6;
+            // Switching from new to classic font behavior.
+            // Move cursor pos up 6 pixels so it's at top-left of char.
+            cursor_y -= 6;
         }
 
         fontHeight = 8;
         fontDesc = 0;
-        }
-        gfxFont = (GFXfont *)f;
+    }
+    gfxFont = (GFXfont *)f;
 }
 
 // Broke this out as it's used by both the PROGMEM- and RAM-resident
@@ -1014,16 +1907,15 @@ void Adafruit_GFX::charBounds(char c, int16_t *x, int16_t *y,
             *x  = 0;    // Reset x to zero, advance y by one line
             *y += textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
         } else if(c != '\r') { // Not a carriage return; is normal char
-            uint8_t first = pgm_read_byte(&gfxFont->first),
-                    last  = pgm_read_byte(&gfxFont->last);
-            if((c >= first) && (c <= last)) { // Char present in this font?
-                GFXglyph *glyph = &(((GFXglyph *)pgm_read_pointer(
-                  &gfxFont->glyph))[c - first]);
-                uint8_t gw = pgm_read_byte(&glyph->width),
-                        gh = pgm_read_byte(&glyph->height),
-                        xa = pgm_read_byte(&glyph->xAdvance);
-                int8_t  xo = pgm_read_byte(&glyph->xOffset),
-                        yo = pgm_read_byte(&glyph->yOffset);
+            int16_t gi = glyphIndex(gfxFont, c);
+            if(gi >= 0) { // Char present in this font?
+                GFXglyph glyph;
+                readGlyph(gfxFont, gi, &glyph);
+                uint8_t gw = glyph.width,
+                        gh = glyph.height,
+                        xa = glyph.xAdvance;
+                int8_t  xo = glyph.xOffset,
+                        yo = glyph.yOffset;
                 if(wrap && ((*x+(((int16_t)xo+gw)*textsize)) > _width)) {
                     *x  = 0; // Reset x to zero, advance y by one line
                     *y += textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
@@ -1124,6 +2016,11 @@ void Adafruit_GFX::invertDisplay(boolean i) {
     // Do nothing, must be subclassed if supported by hardware
 }
 
+boolean Adafruit_GFX::setDisplayStartLine(int16_t y) {
+    // Not supported, must be subclassed if the hardware can remap rows
+    return false;
+}
+
 /***************************************************************************/
 // code for the GFX button UI element
 
@@ -1198,6 +2095,299 @@ boolean Adafruit_GFX_Button::isPressed() { return currstate; }
 boolean Adafruit_GFX_Button::justPressed() { return (currstate && !laststate); }
 boolean Adafruit_GFX_Button::justReleased() { return (!currstate && laststate); }
 
+/***************************************************************************/
+// code for a group of GFX buttons
+
+Adafruit_GFX_ButtonGroup::Adafruit_GFX_ButtonGroup(void) {
+  _count   = 0;
+  _drawn   = _drawnPressed = 0;
+  _dirtyX1 = _dirtyY1 = 0x7FFF;
+  _dirtyX2 = _dirtyY2 = -1;
+  buildGrid();
+}
+
+boolean Adafruit_GFX_ButtonGroup::add(Adafruit_GFX_Button *button) {
+  if(_count >= GFX_BUTTONGROUP_MAX) return false;
+  button->currstate = button->laststate = false;
+  _buttons[_count++] = button;
+  buildGrid();
+  return true;
+}
+
+uint8_t Adafruit_GFX_ButtonGroup::count(void) {
+  return _count;
+}
+
+Adafruit_GFX_Button *Adafruit_GFX_ButtonGroup::getButton(uint8_t i) {
+  return (i < _count) ? _buttons[i] : NULL;
+}
+
+// Divide the area covered by all buttons in a grid and mark in each cell
+// which buttons overlap it.
+void Adafruit_GFX_ButtonGroup::buildGrid(void) {
+  uint8_t i;
+
+  memset(_cells, 0, sizeof(_cells));
+  _gridX1 = _gridY1 = 0x7FFF;
+  _gridX2 = _gridY2 = -0x7FFF;
+  for(i=0; i<_count; i++) {
+    Adafruit_GFX_Button *b = _buttons[i];
+    int16_t x2 = b->_x1 + (int16_t)b->_w, y2 = b->_y1 + (int16_t)b->_h;
+    if(b->_x1 < _gridX1) _gridX1 = b->_x1;
+    if(b->_y1 < _gridY1) _gridY1 = b->_y1;
+    if(x2 > _gridX2)     _gridX2 = x2;
+    if(y2 > _gridY2)     _gridY2 = y2;
+  }
+  if(!_count) return;
+
+  int16_t gw = _gridX2 - _gridX1, gh = _gridY2 - _gridY1;
+  if((gw <= 0) || (gh <= 0)) return; // No area yet, find() rejects all
+  for(i=0; i<_count; i++) {
+    Adafruit_GFX_Button *b = _buttons[i];
+    // Range of cells covered by this button (right/bottom edge exclusive)
+    int16_t x1 = b->_x1 - _gridX1, y1 = b->_y1 - _gridY1,
+            c1 = (int32_t)x1 * GFX_BUTTONGROUP_COLS / gw,
+            c2 = (int32_t)(x1 + (int16_t)b->_w - 1) * GFX_BUTTONGROUP_COLS / gw,
+            r1 = (int32_t)y1 * GFX_BUTTONGROUP_ROWS / gh,
+            r2 = (int32_t)(y1 + (int16_t)b->_h - 1) * GFX_BUTTONGROUP_ROWS / gh;
+    for(int16_t r=r1; r<=r2; r++) {
+      for(int16_t c=c1; c<=c2; c++) {
+        _cells[r * GFX_BUTTONGROUP_COLS + c] |= (1 << i);
+      }
+    }
+  }
+}
+
+int8_t Adafruit_GFX_ButtonGroup::find(int16_t x, int16_t y) {
+  if((x < _gridX1) || (x >= _gridX2) || (y < _gridY1) || (y >= _gridY2))
+    return -1;
+
+  uint8_t c = (int32_t)(x - _gridX1) * GFX_BUTTONGROUP_COLS / (_gridX2 - _gridX1),
+          r = (int32_t)(y - _gridY1) * GFX_BUTTONGROUP_ROWS / (_gridY2 - _gridY1);
+  uint16_t mask = _cells[r * GFX_BUTTONGROUP_COLS + c];
+  for(uint8_t i=0; mask; i++, mask >>= 1) {
+    if((mask & 1) && _buttons[i]->contains(x, y)) return i;
+  }
+  return -1;
+}
+
+int8_t Adafruit_GFX_ButtonGroup::press(int16_t x, int16_t y, boolean pressed) {
+  int8_t hit = pressed ? find(x, y) : -1;
+  for(uint8_t i=0; i<_count; i++) {
+    _buttons[i]->press(i == hit);
+  }
+  return hit;
+}
+
+void Adafruit_GFX_ButtonGroup::drawButtons(boolean all) {
+  for(uint8_t i=0; i<_count; i++) {
+    Adafruit_GFX_Button *b    = _buttons[i];
+    uint16_t             bit  = (1 << i);
+    boolean              down = b->isPressed();
+
+    if(!all && (_drawn & bit) && (((_drawnPressed & bit) != 0) == down))
+      continue; // Unchanged since last drawn
+
+    b->drawButton(down);
+    _drawn |= bit;
+    if(down) _drawnPressed |=  bit;
+    else     _drawnPressed &= ~bit;
+
+    // Grow dirty area
+    int16_t x2 = b->_x1 + (int16_t)b->_w - 1, y2 = b->_y1 + (int16_t)b->_h - 1;
+    if(b->_x1 < _dirtyX1) _dirtyX1 = b->_x1;
+    if(b->_y1 < _dirtyY1) _dirtyY1 = b->_y1;
+    if(x2 > _dirtyX2)     _dirtyX2 = x2;
+    if(y2 > _dirtyY2)     _dirtyY2 = y2;
+  }
+}
+
+boolean Adafruit_GFX_ButtonGroup::getDirtyRect(int16_t *x, int16_t *y,
+  uint16_t *w, uint16_t *h) {
+  if(_dirtyX2 < _dirtyX1) return false;
+
+  *x = _dirtyX1;
+  *y = _dirtyY1;
+  *w = _dirtyX2 - _dirtyX1 + 1;
+  *h = _dirtyY2 - _dirtyY1 + 1;
+  _dirtyX1 = _dirtyY1 = 0x7FFF;
+  _dirtyX2 = _dirtyY2 = -1;
+  return true;
+}
+
+/***************************************************************************/
+// code for a fixed-slot number field
+
+Adafruit_GFX_NumberField::Adafruit_GFX_NumberField(void) {
+  _gfx     = 0;
+  _font    = NULL;
+  _slots   = 0;
+  _dirtyX1 = _dirtyY1 = 0x7FFF;
+  _dirtyX2 = _dirtyY2 = -1;
+}
+
+void Adafruit_GFX_NumberField::init(Adafruit_GFX *gfx, int16_t x, int16_t y,
+  uint8_t slots, uint16_t color, uint16_t bg, uint8_t textsize,
+  const GFXfont *f) {
+  _gfx      = gfx;
+  _x        = x;
+  _y        = y;
+  _slots    = (slots > GFX_NUMBERFIELD_MAX) ? GFX_NUMBERFIELD_MAX : slots;
+  _color    = color;
+  _bg       = bg;
+  _textsize = textsize ? textsize : 1;
+  _font     = f;
+
+  // Slot width is the widest digit, so all digits line up
+  _slotW = 6;
+  if(f) {
+    GFXglyph *glyphs = (GFXglyph *)pgm_read_pointer(&f->glyph);
+    _slotW = 0;
+    for(uint8_t c='0'; c<='9'; c++) {
+      int16_t gi = glyphIndex(f, c);
+      if(gi < 0) continue;
+      uint8_t xa = pgm_read_byte(&glyphs[gi].xAdvance);
+      if(xa > _slotW) _slotW = xa;
+    }
+    if(!_slotW) _slotW = pgm_read_byte(&f->yAdvance) / 2;
+  }
+
+  memset(_boxW, 0, sizeof(_boxW));
+  invalidate();
+}
+
+void Adafruit_GFX_NumberField::invalidate(void) {
+  // No slot shows a NUL, so everything is redrawn.  The glyph boxes are
+  // kept to erase what is on screen now.
+  memset(_prev, 0, sizeof(_prev));
+}
+
+int16_t Adafruit_GFX_NumberField::getSlotWidth(void) {
+  return (int16_t)_slotW * _textsize;
+}
+
+// Get the box of character c relative to its slot origin (in font pixels,
+// w=0 if nothing is drawn).  Returns the x offset at which to draw c, which
+// centers narrow characters like ':' or '.' in their slot.
+int8_t Adafruit_GFX_NumberField::glyphBox(uint8_t c, int8_t *x, int8_t *y,
+  uint8_t *w, uint8_t *h) {
+  if(!_font) {
+    *x = *y = 0;
+    *w = 6;
+    *h = 8;
+    return 0;
+  }
+
+  int16_t gi = glyphIndex(_font, c);
+  if(gi < 0) {
+    *x = *y = *w = *h = 0;
+    return 0;
+  }
+
+  GFXglyph *glyph = &(((GFXglyph *)pgm_read_pointer(&_font->glyph))[gi]);
+  int8_t dx = ((int16_t)_slotW - pgm_read_byte(&glyph->xAdvance)) / 2;
+  *x = dx + (int8_t)pgm_read_byte(&glyph->xOffset);
+  *y = pgm_read_byte(&glyph->yOffset);
+  *w = pgm_read_byte(&glyph->width);
+  *h = pgm_read_byte(&glyph->height);
+  return dx;
+}
+
+void Adafruit_GFX_NumberField::addDirty(int16_t x, int16_t y, int16_t w,
+  int16_t h) {
+  if(x < _dirtyX1)         _dirtyX1 = x;
+  if(y < _dirtyY1)         _dirtyY1 = y;
+  if(x + w - 1 > _dirtyX2) _dirtyX2 = x + w - 1;
+  if(y + h - 1 > _dirtyY2) _dirtyY2 = y + h - 1;
+}
+
+// Redraw the slots that differ from s (exactly _slots chars, no NUL needed)
+uint8_t Adafruit_GFX_NumberField::update(const char *s) {
+  if(!_gfx) return 0;
+
+  int16_t cx = _gfx->getCursorX(), cy = _gfx->getCursorY();
+  uint8_t n  = 0, ts = _textsize;
+
+  _gfx->setFont(_font);
+  for(uint8_t i=0; i<_slots; i++) {
+    uint8_t c = s[i];
+    if(c == (uint8_t)_prev[i]) continue;
+
+    int16_t sx = _x + i * (int16_t)_slotW * ts;
+    int8_t  bx, by;
+    uint8_t bw, bh;
+    int8_t  dx = glyphBox(c, &bx, &by, &bw, &bh);
+
+    if(!_font) {
+      // Classic glyphs cover the whole cell, background included
+      _gfx->drawChar(sx, _y, c, _color, _bg, ts);
+      addDirty(sx, _y, 6 * ts, 8 * ts);
+    } else {
+      // Erase the old glyph box, then draw the new glyph on top
+      if(_boxW[i] && _boxH[i]) {
+        int16_t ex = sx + _boxX[i] * ts, ey = _y + _boxY[i] * ts;
+        _gfx->fillRect(ex, ey, _boxW[i] * ts, _boxH[i] * ts, _bg);
+        addDirty(ex, ey, _boxW[i] * ts, _boxH[i] * ts);
+      }
+      if(bw && bh) {
+        _gfx->drawChar(sx + dx * ts, _y, c, _color, _bg, ts);
+        addDirty(sx + bx * ts, _y + by * ts, bw * ts, bh * ts);
+      }
+    }
+    _prev[i] = c;
+    _boxX[i] = bx;
+    _boxY[i] = by;
+    _boxW[i] = bw;
+    _boxH[i] = bh;
+    n++;
+  }
+  _gfx->setCursor(cx, cy);
+  return n;
+}
+
+uint8_t Adafruit_GFX_NumberField::setText(const char *s) {
+  char    buf[GFX_NUMBERFIELD_MAX];
+  uint8_t i = 0;
+
+  for(; (i < _slots) && s[i]; i++) buf[i] = s[i];
+  for(; i < _slots; i++)           buf[i] = ' ';
+  return update(buf);
+}
+
+uint8_t Adafruit_GFX_NumberField::setValue(int32_t value, uint8_t zeroPad) {
+  char     buf[GFX_NUMBERFIELD_MAX];
+  uint32_t v = (value < 0) ? -(uint32_t)value : value;
+  int8_t   i = _slots;
+
+  if(!i) return 0;
+  if(zeroPad > _slots) zeroPad = _slots;
+  do {
+    buf[--i] = '0' + (v % 10);
+    v /= 10;
+  } while((i > 0) && (v || (_slots - i < zeroPad)));
+
+  if(v || ((value < 0) && (i == 0))) {
+    memset(buf, '*', _slots); // Doesn't fit
+  } else {
+    if(value < 0) buf[--i] = '-';
+    while(i > 0) buf[--i] = ' ';
+  }
+  return update(buf);
+}
+
+boolean Adafruit_GFX_NumberField::getDirtyRect(int16_t *x, int16_t *y,
+  uint16_t *w, uint16_t *h) {
+  if(_dirtyX2 < _dirtyX1) return false;
+
+  *x = _dirtyX1;
+  *y = _dirtyY1;
+  *w = _dirtyX2 - _dirtyX1 + 1;
+  *h = _dirtyY2 - _dirtyY1 + 1;
+  _dirtyX1 = _dirtyY1 = 0x7FFF;
+  _dirtyX2 = _dirtyY2 = -1;
+  return true;
+}
+
 // -------------------------------------------------------------------------
 
 // GFXcanvas1, GFXcanvas8 and GFXcanvas16 (currently a WIP, don't get too
@@ -1217,7 +2407,233 @@ boolean Adafruit_GFX_Button::justReleased() { return (!currstate && laststate);
 // scanline pad).
 // NOT EXTENSIVELY TESTED YET.  MAY CONTAIN WORST BUGS KNOWN TO HUMANKIND.
 
-GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+GFXlazyClear::GFXlazyClear(uint16_t rows) {
+    _lazyRows    = rows;
+    _lazyShift   = 3;
+    while(((uint32_t)(rows - 1) >> _lazyShift) >= 32) _lazyShift++;
+    _lazyPending = 0;
+    _lazyColor   = 0;
+    _lazyOn      = false;
+}
+
+// Turning lazy clear off fills the pending blocks, so the buffer is
+// complete again for code that reads it directly.
+void GFXlazyClear::setLazyClear(boolean on) {
+    if(!on) lazyFlush();
+    _lazyOn = on;
+}
+
+boolean GFXlazyClear::getLazyClear(void) const {
+    return _lazyOn;
+}
+
+boolean GFXlazyClear::lazyFill(uint16_t color) {
+    if(!_lazyOn) return false;
+    uint8_t blocks = ((_lazyRows - 1) >> _lazyShift) + 1;
+    _lazyPending = (blocks >= 32) ? 0xFFFFFFFF : ((uint32_t)1 << blocks) - 1;
+    _lazyColor   = color;
+    return true;
+}
+
+void GFXlazyClear::lazyFlush(uint32_t blocks) {
+    int16_t y, n = 1 << _lazyShift;
+
+    blocks       &= _lazyPending;
+    _lazyPending &= ~blocks;
+    for(y=0; blocks; y += n, blocks >>= 1) {
+        if(blocks & 1) fillRows(y, (y + n > _lazyRows) ? _lazyRows - y : n,
+                         _lazyColor);
+    }
+}
+
+GFXdoubleBuffer::GFXdoubleBuffer(uint16_t rowBytes, uint16_t rows,
+  uint8_t unit) {
+    _front      = NULL;
+    _rowBytes   = rowBytes;
+    _rows       = rows;
+    _unit       = unit;
+    _frontValid = false;
+}
+
+GFXdoubleBuffer::~GFXdoubleBuffer(void) {
+    if(_front) free(_front);
+}
+
+// The front buffer starts out invalid, so the first flush passes all rows
+boolean GFXdoubleBuffer::setDoubleBuffer(boolean on) {
+    if(on && !_front) {
+        if(!(_front = (uint8_t *)malloc((uint32_t)_rowBytes * _rows)))
+            return false;
+        _frontValid = false;
+    } else if(!on && _front) {
+        free(_front);
+        _front      = NULL;
+        _frontValid = false;
+    }
+    return true;
+}
+
+boolean GFXdoubleBuffer::getDoubleBuffer(void) const {
+    return _front != NULL;
+}
+
+const uint8_t *GFXdoubleBuffer::getFrontBuffer(void) const {
+    return _front;
+}
+
+void GFXdoubleBuffer::invalidateFront(void) {
+    _frontValid = false;
+}
+
+uint32_t GFXdoubleBuffer::flushChanges(GFXflushFunc func, void *arg) {
+    uint8_t  *back = backBuffer(), *b, *f;
+    uint16_t  row, i, start, end, gap;
+    uint32_t  total = 0;
+
+    if(!back) return 0;
+    for(row=0; row<_rows; row++) {
+        b = back + (uint32_t)row * _rowBytes;
+        if(!_frontValid) {
+            // Pass the front row, that stays put while drawing goes on
+            if(_front) {
+                f = _front + (uint32_t)row * _rowBytes;
+                memcpy(f, b, _rowBytes);
+            } else f = b;
+            if(func) func(arg, row, 0, f, _rowBytes);
+            total += _rowBytes;
+            continue;
+        }
+        f = _front + (uint32_t)row * _rowBytes;
+        for(i=0; i<_rowBytes; ) {
+            // Skip equal words where both rows are aligned, else equal bytes
+            if(!(((uintptr_t)(b + i) | (uintptr_t)(f + i)) & 3) &&
+               (i + 4 <= _rowBytes) &&
+               (*(const uint32_t *)(b + i) == *(const uint32_t *)(f + i))) {
+                i += 4;
+                continue;
+            }
+            if(b[i] == f[i]) {
+                i++;
+                continue;
+            }
+            // A run ends with GFX_FLUSH_GAP equal bytes or the row
+            start = i;
+            end   = ++i;
+            for(gap=0; (i < _rowBytes) && (gap < GFX_FLUSH_GAP); i++) {
+                if(b[i] != f[i]) {
+                    end = i + 1;
+                    gap = 0;
+                } else gap++;
+            }
+            start -= start % _unit;
+            if(end % _unit) end += _unit - end % _unit;
+            memcpy(f + start, b + start, end - start);
+            if(func) func(arg, row, start, f + start, end - start);
+            total += end - start;
+        }
+    }
+    if(_front) _frontValid = true;
+    return total;
+}
+
+GFXpalette::GFXpalette(uint8_t bits) {
+    _colors = NULL;
+    _gray   = NULL;
+    _count  = 0;
+    _bits   = bits;
+}
+
+GFXpalette::~GFXpalette(void) {
+    if(_gray) free(_gray);
+}
+
+boolean GFXpalette::setPalette(const uint16_t *colors, uint16_t count) {
+    if(_gray) free(_gray);
+    _colors = NULL;
+    _gray   = NULL;
+    _count  = 0;
+    if(!colors || !count) return true;
+    if(count > (1 << _bits)) count = 1 << _bits;
+    if(!(_gray = (uint8_t *)malloc(count))) return false;
+
+    // Gray level of each color, RGB565 widened to 8 bits per channel
+    for(uint16_t i=0; i<count; i++) {
+        uint16_t c = colors[i];
+        uint8_t  r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        _gray[i] = ((uint16_t)((r << 3) | (r >> 2)) * 77 +
+                    (uint16_t)((g << 2) | (g >> 4)) * 150 +
+                    (uint16_t)((b << 3) | (b >> 2)) * 29) >> 8;
+    }
+    _colors = colors;
+    _count  = count;
+    return true;
+}
+
+// Indexes past the end of the palette are black
+uint16_t GFXpalette::getPaletteColor(uint8_t index) const {
+    if(_colors) return (index < _count) ? _colors[index] : 0;
+    uint8_t g = getPaletteGray(index);
+    return ((uint16_t)(g & 0xF8) << 8) | ((g & 0xFC) << 3) | (g >> 3);
+}
+
+uint8_t GFXpalette::getPaletteGray(uint8_t index) const {
+    if(_gray) return (index < _count) ? _gray[index] : 0;
+    return (_bits == 8) ? index : (index & 0x0F) * 17;
+}
+
+void GFXpalette::convertRow565(const uint8_t *src, uint8_t fill, int16_t w,
+  uint16_t *dst) const {
+    if(!src) {
+        uint16_t c = getPaletteColor(fill);
+        while(w-- > 0) *dst++ = c;
+    } else if(_bits == 8) {
+        while(w-- > 0) *dst++ = getPaletteColor(*src++);
+    } else {
+        for(; w > 1; w -= 2, src++) {
+            *dst++ = getPaletteColor(*src >> 4);
+            *dst++ = getPaletteColor(*src & 0x0F);
+        }
+        if(w > 0) *dst = getPaletteColor(*src >> 4);
+    }
+}
+
+// A pixel is dark when its gray level is below the threshold of its column.
+// For dithering the thresholds of the row come from the Bayer matrix, such
+// that gray g is dark where GFXbayer8 < ((255 - g) * 65) >> 8, the same
+// coverage as grayPattern() and GFXimage.
+void GFXpalette::convertRow1(const uint8_t *src, uint8_t fill, int16_t w,
+  int16_t y, uint8_t *dst, uint8_t threshold) const {
+    uint8_t t[8], bits = 0, c;
+    int16_t x;
+
+    for(c=0; c<8; c++) {
+        if(threshold) {
+            t[c] = threshold;
+        } else {
+            uint8_t b = pgm_read_byte(&GFXbayer8[(y & 7) * 8 + c]);
+            t[c] = 256 - ((uint16_t)(b + 1) * 256 + 64) / 65;
+        }
+    }
+
+    if(!src) {  // Same index all along, so all bytes are the same
+        uint8_t g = getPaletteGray(fill);
+        for(c=0; c<8; c++) bits = (bits << 1) | (g < t[c]);
+        memset(dst, bits, (w + 7) / 8);
+        if(w & 7) dst[w / 8] &= 0xFF << (8 - (w & 7));
+        return;
+    }
+    for(x=0; x<w; x++) {
+        if(_bits == 8)  c = src[x];
+        else if(x & 1)  c = src[x >> 1] & 0x0F;
+        else            c = src[x >> 1] >> 4;
+        bits = (bits << 1) | (getPaletteGray(c) < t[x & 7]);
+        if((x & 7) == 7) *dst++ = bits;
+    }
+    if(w & 7) *dst = bits << (8 - (w & 7));
+}
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h),
+  GFXlazyClear(h), GFXdoubleBuffer((w + 7) / 8, h) {
     uint16_t bytes = ((w + 7) / 8) * h;
     if((buffer = (uint8_t *)malloc(bytes))) {
         memset(buffer, 0, bytes);
@@ -1229,15 +2645,15 @@ GFXcanvas1::~GFXcanvas1(void) {
 }
 
 uint8_t* GFXcanvas1::getBuffer(void) {
+    lazyFlush();
     return buffer;
 }
 
-uint16_t GFXcanvas1::getPixel(int16_t x, int16_t y) {
-  // Bitmask tables of 0x80>>X and ~(0x80>>X), because X>>Y is slow on AVR
-  static const uint8_t PROGMEM
-    GFXsetBit[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 },
-    GFXclrBit[] = { 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE };
+uint8_t* GFXcanvas1::backBuffer(void) {
+    return getBuffer();
+}
 
+uint16_t GFXcanvas1::getPixel(int16_t x, int16_t y) {
   if(buffer) {
     if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return 0;
 
@@ -1259,21 +2675,14 @@ uint16_t GFXcanvas1::getPixel(int16_t x, int16_t y) {
       break;
     }
 
+    if(lazyPending(y)) return _lazyColor ? 1 : 0;
     uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
-
-	// TODO: supports only AVR with pgm_read_byte, see drawPixel
-    return (*ptr & pgm_read_byte(&GFXsetBit[x & 7]))? 1: 0;
+    return (*ptr & gfxBitMask(x & 7)) ? 1 : 0;
   }
+  return 0;
 }
 
 void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
-#ifdef __AVR__
-    // Bitmask tables of 0x80>>X and ~(0x80>>X), because X>>Y is slow on AVR
-    static const uint8_t PROGMEM
-        GFXsetBit[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 },
-        GFXclrBit[] = { 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE };
-#endif
-
     if(buffer) {
         if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
 
@@ -1295,25 +2704,111 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
                 break;
         }
 
+        lazyTouch(y);
         uint8_t   *ptr  = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
-#ifdef __AVR__
-        if(color) *ptr |= pgm_read_byte(&GFXsetBit[x & 7]);
-        else      *ptr &= pgm_read_byte(&GFXclrBit[x & 7]);
-#else
-        if(color) *ptr |=   0x80 >> (x & 7);
-        else      *ptr &= ~(0x80 >> (x & 7));
-#endif
+        if(color) *ptr |=  gfxBitMask(x & 7);
+        else      *ptr &= ~gfxBitMask(x & 7);
     }
 }
 
 void GFXcanvas1::fillScreen(uint16_t color) {
+    if(!lazyFill(color)) fillRows(0, HEIGHT, color);
+}
+
+void GFXcanvas1::fillRows(int16_t y, int16_t n, uint16_t color) {
     if(buffer) {
-        uint16_t bytes = ((WIDTH + 7) / 8) * HEIGHT;
-        memset(buffer, color ? 0xFF : 0x00, bytes);
+        uint16_t bw = (WIDTH + 7) / 8;
+        memset(buffer + y * bw, color ? 0xFF : 0x00, n * bw);
     }
 }
 
-GFXcanvas8::GFXcanvas8(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+// Clip the w x h block at sx,sy of a sw x sh source canvas, drawn at x,y
+// of a dw x dh destination.  False if nothing is left.
+static boolean blitClip(int16_t &sx, int16_t &sy, int16_t &w, int16_t &h,
+  int16_t &x, int16_t &y, int16_t sw, int16_t sh, int16_t dw, int16_t dh) {
+    if(sx < 0) { w += sx; x -= sx; sx = 0; }
+    if(sy < 0) { h += sy; y -= sy; sy = 0; }
+    if(x < 0)  { w += x; sx -= x; x = 0; }
+    if(y < 0)  { h += y; sy -= y; y = 0; }
+    if(w > sw - sx) w = sw - sx;
+    if(w > dw - x)  w = dw - x;
+    if(h > sh - sy) h = sh - sy;
+    if(h > dh - y)  h = dh - y;
+    return (w > 0) && (h > 0);
+}
+
+// Compose one row of w pixels from src (or w times fill when src is NULL).
+// The mask row starts at bit of *mask; 8 clear mask bits are skipped at once.
+static void blitRow8(uint8_t *dst, const uint8_t *src, uint8_t fill,
+  int16_t w, const uint8_t *mask, uint8_t bit, uint8_t mode, uint8_t key) {
+    uint8_t c, m = 1;
+
+    if(!mask && (mode == GFX_BLIT_COPY)) {
+        if(src) memcpy(dst, src, w);
+        else    memset(dst, fill, w);
+        return;
+    }
+    if(!src && (mode == GFX_BLIT_KEY) && (fill == key)) return;
+    while(w > 0) {
+        if(mask) {
+            if((bit == 0x80) && (w >= 8) && !*mask) {
+                mask++;
+                dst += 8;
+                if(src) src += 8;
+                w -= 8;
+                continue;
+            }
+            m = *mask & bit;
+            if(!(bit >>= 1)) { bit = 0x80; mask++; }
+        }
+        c = src ? *src++ : fill;
+        if(m) {
+            if(mode == GFX_BLIT_BLEND) *dst = (*dst & c) + ((*dst ^ c) >> 1);
+            else if((mode == GFX_BLIT_COPY) || (c != key)) *dst = c;
+        }
+        dst++;
+        w--;
+    }
+}
+
+// Same for RGB565.  The 50% blend halves each channel without carries
+// into the next one: (a & b) + ((a ^ b) with the channel LSBs cleared) / 2.
+static void blitRow16(uint16_t *dst, const uint16_t *src, uint16_t fill,
+  int16_t w, const uint8_t *mask, uint8_t bit, uint8_t mode, uint16_t key) {
+    uint16_t c;
+    uint8_t  m = 1;
+
+    if(!mask && (mode == GFX_BLIT_COPY) && src) {
+        memcpy(dst, src, w * 2);
+        return;
+    }
+    if(!src && (mode == GFX_BLIT_KEY) && (fill == key)) return;
+    while(w > 0) {
+        if(mask) {
+            if((bit == 0x80) && (w >= 8) && !*mask) {
+                mask++;
+                dst += 8;
+                if(src) src += 8;
+                w -= 8;
+                continue;
+            }
+            m = *mask & bit;
+            if(!(bit >>= 1)) { bit = 0x80; mask++; }
+        }
+        c = src ? *src++ : fill;
+        if(m) {
+            if(mode == GFX_BLIT_BLEND)
+                *dst = (*dst & c) + (((*dst ^ c) & 0xF7DE) >> 1);
+            else if((mode == GFX_BLIT_COPY) || (c != key))
+                *dst = c;
+        }
+        dst++;
+        w--;
+    }
+}
+
+GFXcanvas8::GFXcanvas8(uint16_t w, uint16_t h) : Adafruit_GFX(w, h),
+  GFXlazyClear(h), GFXpalette(8), GFXdoubleBuffer(w, h) {
     uint32_t bytes = w * h;
     if((buffer = (uint8_t *)malloc(bytes))) {
         memset(buffer, 0, bytes);
@@ -1325,9 +2820,14 @@ GFXcanvas8::~GFXcanvas8(void) {
 }
 
 uint8_t* GFXcanvas8::getBuffer(void) {
+    lazyFlush();
     return buffer;
 }
 
+uint8_t* GFXcanvas8::backBuffer(void) {
+    return getBuffer();
+}
+
 uint16_t GFXcanvas8::getPixel(int16_t x, int16_t y) {
   if(buffer) {
     if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return 0;
@@ -1350,8 +2850,10 @@ uint16_t GFXcanvas8::getPixel(int16_t x, int16_t y) {
       break;
     }
 
+    if(lazyPending(y)) return (uint8_t)_lazyColor;
     return buffer[x + y * WIDTH];
   }
+  return 0;
 }
 
 void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
@@ -1376,20 +2878,25 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
                 break;
         }
 
+        lazyTouch(y);
         buffer[x + y * WIDTH] = color;
     }
 }
 
 void GFXcanvas8::fillScreen(uint16_t color) {
+    if(!lazyFill(color)) fillRows(0, HEIGHT, color);
+}
+
+void GFXcanvas8::fillRows(int16_t y, int16_t n, uint16_t color) {
     if(buffer) {
-        memset(buffer, color, WIDTH * HEIGHT);
+        memset(buffer + (uint32_t)y * WIDTH, color, (uint32_t)n * WIDTH);
     }
 }
 
 void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
   int16_t w, uint16_t color) {
 
-    if((x >= _width) || (y < 0) || (y >= _height)) return;
+    if((w <= 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
     int16_t x2 = x + w - 1;
     if(x2 < 0) return;
 
@@ -1400,28 +2907,225 @@ void GFXcanvas8::writeFastHLine(int16_t x, int16_t y,
     }
     if(x2 >= _width) w = _width - x;
 
-    int16_t t;
     switch(rotation) {
-        case 1:
-            t = x;
-            x = WIDTH  - 1 - y;
-            y = t;
-            break;
-        case 2:
-            x = WIDTH  - 1 - x;
+        case 2: // Row is reversed in the buffer
+            x = WIDTH  - x - w;
             y = HEIGHT - 1 - y;
             break;
-        case 3:
-            t = x;
-            x = y;
-            y = HEIGHT - 1 - t;
-            break;
+        case 1:
+        case 3: // Row is a column in the buffer, no memset
+            Adafruit_GFX::writeFastHLine(x, y, w, color);
+            return;
     }
 
+    lazyTouch(y);
     memset(buffer + y * WIDTH + x, color, w);
 }
 
-GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+void GFXcanvas8::writeGraySpan(int16_t x, int16_t y,
+  const uint8_t *colors, int16_t w) {
+
+    if(!buffer || (rotation & 1)) { // Row is a column in the buffer
+        Adafruit_GFX::writeGraySpan(x, y, colors, w);
+        return;
+    }
+    if((y < 0) || (y >= _height)) return;
+    if(x < 0) { // Clip left/right
+        colors -= x;
+        w      += x;
+        x       = 0;
+    }
+    if(w > _width - x) w = _width - x;
+    if(w <= 0) return;
+
+    if(rotation == 2) { // Row is reversed in the buffer
+        y = HEIGHT - 1 - y;
+        lazyTouch(y);
+        uint8_t *ptr = buffer + (uint32_t)y * WIDTH + WIDTH - 1 - x;
+        while(w--) *ptr-- = *colors++;
+    } else {
+        lazyTouch(y);
+        memcpy(buffer + (uint32_t)y * WIDTH + x, colors, w);
+    }
+}
+
+void GFXcanvas8::getRow565(int16_t y, uint16_t *dst) {
+    if(buffer) convertRow565(lazyPending(y) ? NULL : buffer + y * WIDTH,
+                 _lazyColor, WIDTH, dst);
+}
+
+void GFXcanvas8::getRow1(int16_t y, uint8_t *dst, uint8_t threshold) {
+    if(buffer) convertRow1(lazyPending(y) ? NULL : buffer + y * WIDTH,
+                 _lazyColor, WIDTH, y, dst, threshold);
+}
+
+void GFXcanvas8::blit(const GFXcanvas8 &src, int16_t x, int16_t y,
+  uint8_t mode, uint8_t key, const uint8_t *mask) {
+    blit(src, 0, 0, src.WIDTH, src.HEIGHT, x, y, mode, key, mask);
+}
+
+// Source rows still pending a lazy clear are composed as a constant fill
+void GFXcanvas8::blit(const GFXcanvas8 &src, int16_t sx, int16_t sy,
+  int16_t w, int16_t h, int16_t x, int16_t y, uint8_t mode, uint8_t key,
+  const uint8_t *mask) {
+    if(!buffer || !src.buffer || (&src == this) ||
+       !blitClip(sx, sy, w, h, x, y, src.WIDTH, src.HEIGHT, WIDTH, HEIGHT))
+        return;
+
+    uint16_t stride = (src.WIDTH + 7) / 8;
+    if(mask) mask += (uint32_t)sy * stride + sx / 8;
+    for(; h > 0; h--, y++, sy++) {
+        lazyTouch(y);
+        blitRow8(buffer + (uint32_t)y * WIDTH + x, src.lazyPending(sy) ?
+          NULL : src.buffer + (uint32_t)sy * src.WIDTH + sx,
+          src._lazyColor, w, mask, 0x80 >> (sx & 7), mode, key);
+        if(mask) mask += stride;
+    }
+}
+
+GFXcanvas4::GFXcanvas4(uint16_t w, uint16_t h) : Adafruit_GFX(w, h),
+  GFXlazyClear(h), GFXpalette(4), GFXdoubleBuffer((w + 1) / 2, h) {
+    uint32_t bytes = (uint32_t)((w + 1) / 2) * h;
+    if((buffer = (uint8_t *)malloc(bytes))) {
+        memset(buffer, 0, bytes);
+    }
+}
+
+GFXcanvas4::~GFXcanvas4(void) {
+    if(buffer) free(buffer);
+}
+
+uint8_t* GFXcanvas4::getBuffer(void) {
+    lazyFlush();
+    return buffer;
+}
+
+uint8_t* GFXcanvas4::backBuffer(void) {
+    return getBuffer();
+}
+
+uint16_t GFXcanvas4::getPixel(int16_t x, int16_t y) {
+  if(buffer) {
+    if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return 0;
+
+    int16_t t;
+    switch(rotation) {
+     case 1:
+      t = x;
+      x = WIDTH  - 1 - y;
+      y = t;
+      break;
+     case 2:
+      x = WIDTH  - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+     case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+    }
+
+    if(lazyPending(y)) return _lazyColor & 0x0F;
+    uint8_t b = buffer[(x / 2) + y * ((WIDTH + 1) / 2)];
+    return (x & 1) ? (b & 0x0F) : (b >> 4);
+  }
+  return 0;
+}
+
+void GFXcanvas4::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if(buffer) {
+        if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+
+        int16_t t;
+        switch(rotation) {
+            case 1:
+                t = x;
+                x = WIDTH  - 1 - y;
+                y = t;
+                break;
+            case 2:
+                x = WIDTH  - 1 - x;
+                y = HEIGHT - 1 - y;
+                break;
+            case 3:
+                t = x;
+                x = y;
+                y = HEIGHT - 1 - t;
+                break;
+        }
+
+        lazyTouch(y);
+        uint8_t *ptr = &buffer[(x / 2) + y * ((WIDTH + 1) / 2)];
+        if(x & 1) *ptr = (*ptr & 0xF0) | (color & 0x0F);
+        else      *ptr = (*ptr & 0x0F) | (color << 4);
+    }
+}
+
+void GFXcanvas4::fillScreen(uint16_t color) {
+    if(!lazyFill(color & 0x0F)) fillRows(0, HEIGHT, color);
+}
+
+void GFXcanvas4::fillRows(int16_t y, int16_t n, uint16_t color) {
+    if(buffer) {
+        uint16_t bw = (WIDTH + 1) / 2;
+        memset(buffer + (uint32_t)y * bw, (color & 0x0F) * 0x11,
+          (uint32_t)n * bw);
+    }
+}
+
+// Whole bytes of the row are set with memset, odd end pixels as nibbles
+void GFXcanvas4::writeFastHLine(int16_t x, int16_t y,
+  int16_t w, uint16_t color) {
+
+    if(!buffer || (w <= 0) || (x >= _width) || (y < 0) || (y >= _height))
+        return;
+    int16_t x2 = x + w - 1;
+    if(x2 < 0) return;
+
+    // Clip left/right
+    if(x < 0) {
+        x = 0;
+        w = x2 + 1;
+    }
+    if(x2 >= _width) w = _width - x;
+
+    switch(rotation) {
+        case 2: // Row is reversed in the buffer
+            x = WIDTH  - x - w;
+            y = HEIGHT - 1 - y;
+            break;
+        case 1:
+        case 3: // Row is a column in the buffer, no memset
+            Adafruit_GFX::writeFastHLine(x, y, w, color);
+            return;
+    }
+
+    lazyTouch(y);
+    uint8_t *ptr = buffer + y * ((WIDTH + 1) / 2) + x / 2;
+    color &= 0x0F;
+    if(x & 1) {
+        *ptr = (*ptr & 0xF0) | color;
+        ptr++;
+        w--;
+    }
+    memset(ptr, color * 0x11, w / 2);
+    if(w & 1) ptr[w / 2] = (ptr[w / 2] & 0x0F) | (color << 4);
+}
+
+void GFXcanvas4::getRow565(int16_t y, uint16_t *dst) {
+    if(buffer) convertRow565(lazyPending(y) ? NULL :
+                 buffer + y * ((WIDTH + 1) / 2), _lazyColor, WIDTH, dst);
+}
+
+void GFXcanvas4::getRow1(int16_t y, uint8_t *dst, uint8_t threshold) {
+    if(buffer) convertRow1(lazyPending(y) ? NULL :
+                 buffer + y * ((WIDTH + 1) / 2), _lazyColor, WIDTH, y, dst,
+                 threshold);
+}
+
+GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h),
+  GFXlazyClear(h), GFXdoubleBuffer(w * 2, h, 2) {
     uint32_t bytes = w * h * 2;
     if((buffer = (uint16_t *)malloc(bytes))) {
         memset(buffer, 0, bytes);
@@ -1433,9 +3137,14 @@ GFXcanvas16::~GFXcanvas16(void) {
 }
 
 uint16_t* GFXcanvas16::getBuffer(void) {
+    lazyFlush();
     return buffer;
 }
 
+uint8_t* GFXcanvas16::backBuffer(void) {
+    return (uint8_t *)getBuffer();
+}
+
 uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) {
   if(buffer) {
     if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return 0;
@@ -1458,8 +3167,10 @@ uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) {
       break;
     }
 
+    if(lazyPending(y)) return _lazyColor;
     return buffer[x + y * WIDTH];
   }
+  return 0;
 }
 
 void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
@@ -1484,6 +3195,7 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
                 break;
         }
 
+        lazyTouch(y);
         buffer[x + y * WIDTH] = color;
     }
 }
@@ -1527,17 +3239,72 @@ void Adafruit_GFX::dispCopy(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_
 }
 
 void GFXcanvas16::fillScreen(uint16_t color) {
+    if(!lazyFill(color)) fillRows(0, HEIGHT, color);
+}
+
+void GFXcanvas16::fillRows(int16_t y, int16_t n, uint16_t color) {
     if(buffer) {
-        uint8_t hi = color >> 8, lo = color & 0xFF;
+        uint8_t   hi = color >> 8, lo = color & 0xFF;
+        uint16_t *ptr = buffer + (uint32_t)y * WIDTH;
         if(hi == lo) {
-            memset(buffer, lo, WIDTH * HEIGHT * 2);
+            memset(ptr, lo, (uint32_t)n * WIDTH * 2);
         } else {
-            uint32_t i, pixels = WIDTH * HEIGHT;
-            for(i=0; i<pixels; i++) buffer[i] = color;
+            uint32_t i, pixels = (uint32_t)n * WIDTH;
+            for(i=0; i<pixels; i++) ptr[i] = color;
         }
     }
 }
 
+void GFXcanvas16::writeRGBSpan(int16_t x, int16_t y,
+  const uint16_t *colors, int16_t w) {
+
+    if(!buffer || (rotation & 1)) { // Row is a column in the buffer
+        Adafruit_GFX::writeRGBSpan(x, y, colors, w);
+        return;
+    }
+    if((y < 0) || (y >= _height)) return;
+    if(x < 0) { // Clip left/right
+        colors -= x;
+        w      += x;
+        x       = 0;
+    }
+    if(w > _width - x) w = _width - x;
+    if(w <= 0) return;
+
+    if(rotation == 2) { // Row is reversed in the buffer
+        y = HEIGHT - 1 - y;
+        lazyTouch(y);
+        uint16_t *ptr = buffer + (uint32_t)y * WIDTH + WIDTH - 1 - x;
+        while(w--) *ptr-- = *colors++;
+    } else {
+        lazyTouch(y);
+        memcpy(buffer + (uint32_t)y * WIDTH + x, colors, w * 2);
+    }
+}
+
+void GFXcanvas16::blit(const GFXcanvas16 &src, int16_t x, int16_t y,
+  uint8_t mode, uint16_t key, const uint8_t *mask) {
+    blit(src, 0, 0, src.WIDTH, src.HEIGHT, x, y, mode, key, mask);
+}
+
+void GFXcanvas16::blit(const GFXcanvas16 &src, int16_t sx, int16_t sy,
+  int16_t w, int16_t h, int16_t x, int16_t y, uint8_t mode, uint16_t key,
+  const uint8_t *mask) {
+    if(!buffer || !src.buffer || (&src == this) ||
+       !blitClip(sx, sy, w, h, x, y, src.WIDTH, src.HEIGHT, WIDTH, HEIGHT))
+        return;
+
+    uint16_t stride = (src.WIDTH + 7) / 8;
+    if(mask) mask += (uint32_t)sy * stride + sx / 8;
+    for(; h > 0; h--, y++, sy++) {
+        lazyTouch(y);
+        blitRow16(buffer + (uint32_t)y * WIDTH + x, src.lazyPending(sy) ?
+          NULL : src.buffer + (uint32_t)sy * src.WIDTH + sx,
+          src._lazyColor, w, mask, 0x80 >> (sx & 7), mode, key);
+        if(mask) mask += stride;
+    }
+}
+
 void Adafruit_GFX::scrollUp(uint8_t lineHeight, uint16_t color) {
 // MMOLE 171028: bits taken from pull request #60
   // Scroll display up (dispCopy uses getPixel, which takes care of rotation
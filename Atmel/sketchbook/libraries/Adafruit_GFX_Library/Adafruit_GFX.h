@@ -8,6 +8,7 @@
  #include "WProgram.h"
 #endif
 #include "gfxfont.h"
+#include "GFXbackend.h"   // PROGMEM access and bit operations per platform
 
 class Adafruit_GFX : public Print {
 
@@ -27,6 +28,16 @@ class Adafruit_GFX : public Print {
   virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
   virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  // Span with an 8x8 pattern: row y & 7 of the pattern, bit 7 is x & 7 == 0.
+  // 1 bits are drawn with color, 0 bits with bg (skipped if bg == color).
+  virtual void writeFastHLinePattern(int16_t x, int16_t y, int16_t w,
+    const uint8_t pattern[8], uint16_t color, uint16_t bg);
+  // Row of w pixels from x,y to the right, one color per pixel (in RAM).
+  // Drivers that can stream pixels or copy them to a buffer may override.
+  virtual void writeRGBSpan(int16_t x, int16_t y, const uint16_t *colors,
+    int16_t w);
+  virtual void writeGraySpan(int16_t x, int16_t y, const uint8_t *colors,
+    int16_t w);
   virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
   virtual void endWrite(void);
 
@@ -35,6 +46,9 @@ class Adafruit_GFX : public Print {
   // optimized code.  Otherwise 'generic' versions are used.
   virtual void setRotation(uint8_t r);
   virtual void invertDisplay(boolean i);
+  // Show framebuffer row y at the top of the panel (rows wrap around).
+  // Returns false if the display can't remap rows at that offset.
+  virtual boolean setDisplayStartLine(int16_t y);
 
   // BASIC DRAW API
   // These MAY be overridden by the subclass to provide device-specific
@@ -44,6 +58,8 @@ class Adafruit_GFX : public Print {
     drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
     drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
     fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
+    fillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h,
+      const uint8_t pattern[8], uint16_t color, uint16_t bg),
 		dispCopy(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t x1, int16_t y1),
     fillScreen(uint16_t color),
 /* not supported by my drivers yet
@@ -64,10 +80,25 @@ class Adafruit_GFX : public Print {
     fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
     fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
       int16_t delta, uint16_t color),
+    fillCirclePattern(int16_t x0, int16_t y0, int16_t r,
+      const uint8_t pattern[8], uint16_t color, uint16_t bg),
+    drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+      uint8_t thickness, uint16_t color),
+    drawQuadBezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+      int16_t x2, int16_t y2, uint16_t color),
+    drawCubicBezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+      int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint16_t color),
+    drawArc(int16_t x0, int16_t y0, int16_t r, int16_t start, int16_t end,
+      uint16_t color),
+    fillArc(int16_t x0, int16_t y0, int16_t r1, int16_t r2, int16_t start,
+      int16_t end, uint16_t color),
     drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
       int16_t x2, int16_t y2, uint16_t color),
     fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
       int16_t x2, int16_t y2, uint16_t color),
+    fillTrianglePattern(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+      int16_t x2, int16_t y2, const uint8_t pattern[8], uint16_t color,
+      uint16_t bg),
     drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
       int16_t radius, uint16_t color),
     fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
@@ -82,6 +113,17 @@ class Adafruit_GFX : public Print {
       int16_t w, int16_t h, uint16_t color, uint16_t bg),
     drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
       int16_t w, int16_t h, uint16_t color),
+    // Rotated (degrees, clockwise) and scaled (256 = 1:1) around the pivot
+    // pixel px,py, which lands on x,y.  bg == color draws transparent.
+    drawBitmapRotated(int16_t x, int16_t y, const uint8_t bitmap[],
+      int16_t w, int16_t h, int16_t px, int16_t py, int16_t angle,
+      uint16_t scale, uint16_t color, uint16_t bg),
+    drawBitmapRotated(int16_t x, int16_t y, uint8_t *bitmap,
+      int16_t w, int16_t h, int16_t px, int16_t py, int16_t angle,
+      uint16_t scale, uint16_t color, uint16_t bg),
+    drawCanvasRotated(int16_t x, int16_t y, Adafruit_GFX *canvas,
+      int16_t px, int16_t py, int16_t angle, uint16_t scale,
+      uint16_t transparent),
     drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
       int16_t w, int16_t h),
     drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap,
@@ -100,6 +142,17 @@ class Adafruit_GFX : public Print {
       int16_t w, int16_t h),
     drawRGBBitmap(int16_t x, int16_t y,
       uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h),
+    // Mask as run lengths (see maskconvert): for each row alternately the
+    // number of transparent and opaque pixels, until the row is complete.
+    // Opaque runs are drawn with writeGraySpan() or writeRGBSpan().
+    drawGrayscaleBitmapRLE(int16_t x, int16_t y,
+      const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h),
+    drawGrayscaleBitmapRLE(int16_t x, int16_t y,
+      uint8_t *bitmap, uint8_t *mask, int16_t w, int16_t h),
+    drawRGBBitmapRLE(int16_t x, int16_t y,
+      const uint16_t bitmap[], const uint8_t mask[], int16_t w, int16_t h),
+    drawRGBBitmapRLE(int16_t x, int16_t y,
+      uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h),
     drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
       uint16_t bg, uint8_t size),
     setCursor(int16_t x, int16_t y),
@@ -107,6 +160,7 @@ class Adafruit_GFX : public Print {
     setTextColor(uint16_t c, uint16_t bg),
     setTextSize(uint8_t s),
     setTextWrap(boolean w),
+    setTextSmooth(boolean s),
     setTextAutoScroll(boolean s),
     cp437(boolean x=true),
     setFont(const GFXfont *f = NULL),
@@ -116,18 +170,25 @@ class Adafruit_GFX : public Print {
       int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h),
     checkScrollWrap(int16_t fontWidth),
     scrollUp(uint8_t c, uint16_t color);
+  // Fill the area of pixels with the color at (x,y). Returns false when the
+  // span stack ran full and parts of the area were left unfilled.
+  boolean floodFill(int16_t x, int16_t y, uint16_t color);
 /*  not supported by my drivers yet
     scrollUp(uint8_t c, uint16_t color),
     scrollDown(uint8_t c, uint16_t color),
     scrollLeft(uint8_t c, uint16_t color),
     scrollRight(uint8_t c, uint16_t color);
 */
+  // Ordered dither pattern for gray level 0 (all bg) to 64 (all color)
+  static void grayPattern(uint8_t level, uint8_t pattern[8]);
 
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
 #else
   virtual void   write(uint8_t);
 #endif
+  size_t printFixed(int32_t value, uint8_t decimals = 0, uint8_t width = 0,
+    boolean zeroPad = false);
 
   int16_t height(void) const;
   int16_t width(void) const;
@@ -141,7 +202,12 @@ class Adafruit_GFX : public Print {
  protected:
   void
     charBounds(char c, int16_t *x, int16_t *y,
-      int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
+      int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy),
+    writeLineRuns(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+      uint8_t thickness, uint16_t color),
+    fillTriangleSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+      int16_t x2, int16_t y2, const uint8_t *pattern, uint16_t color,
+      uint16_t bg);
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
@@ -156,7 +222,8 @@ class Adafruit_GFX : public Print {
   boolean
     wrap,   // If set, 'wrap' text at right edge of display
     autoscroll,
-    _cp437; // If set, use correct CP437 charset (default is off)
+    _cp437, // If set, use correct CP437 charset (default is off)
+    _smooth; // If set, scaled text is smoothed (see setTextSmooth())
   GFXfont
     *gfxFont;
 };
@@ -190,9 +257,233 @@ class Adafruit_GFX_Button {
   char          _label[10];
 
   boolean currstate, laststate;
+
+  friend class Adafruit_GFX_ButtonGroup;
+};
+
+// Adafruit_GFX_ButtonGroup keeps a set of buttons in a coarse grid over the
+// area they cover.  Each grid cell holds a bitmask of the buttons touching
+// it, so a hit-test only checks the one or two buttons in the touched cell
+// instead of calling contains() on all of them.  drawButtons() redraws only
+// the buttons whose pressed state changed since they were last drawn and
+// keeps track of the area it touched (see getDirtyRect()), so buffered
+// displays can limit the next update to that rectangle.
+#define GFX_BUTTONGROUP_MAX  16 // Max buttons in group (one bit per button)
+#define GFX_BUTTONGROUP_COLS  4 // Grid used for hit-testing
+#define GFX_BUTTONGROUP_ROWS  4
+
+class Adafruit_GFX_ButtonGroup {
+
+ public:
+  Adafruit_GFX_ButtonGroup(void);
+  // Add an initialized button, returns false when the group is full.
+  // Buttons should not be moved (initButton) after adding them.
+  boolean add(Adafruit_GFX_Button *button);
+  uint8_t count(void);
+  Adafruit_GFX_Button *getButton(uint8_t i);
+
+  // Index of the button containing (x,y), or -1 if none
+  int8_t  find(int16_t x, int16_t y);
+  // Update the pressed state of all buttons for a touch at (x,y), pass
+  // pressed=false when not touched.  Returns the index of the pressed
+  // button, or -1 if none.
+  int8_t  press(int16_t x, int16_t y, boolean pressed = true);
+
+  // Draw the buttons whose state changed since last drawn (or all)
+  void    drawButtons(boolean all = false);
+  // Get the area changed by drawButtons() since the previous call.
+  // Returns false if nothing was drawn.
+  boolean getDirtyRect(int16_t *x, int16_t *y, uint16_t *w, uint16_t *h);
+
+ private:
+  void    buildGrid(void);
+
+  Adafruit_GFX_Button *_buttons[GFX_BUTTONGROUP_MAX];
+  uint16_t _cells[GFX_BUTTONGROUP_COLS * GFX_BUTTONGROUP_ROWS];
+  uint16_t _drawnPressed, // Pressed state of each button as last drawn
+           _drawn;        // Set for each button drawn at least once
+  uint8_t  _count;
+  int16_t  _gridX1, _gridY1, _gridX2, _gridY2;   // Area covered by buttons
+  int16_t  _dirtyX1, _dirtyY1, _dirtyX2, _dirtyY2;
+};
+
+// Adafruit_GFX_NumberField is a fixed-width text field for clocks and
+// counters.  Every character gets a slot as wide as the widest digit of the
+// font, and the field remembers what each slot shows.  An update only erases
+// and redraws the slots whose character changed, so a seconds counter
+// redraws one or two digits per tick instead of the whole string.  Works
+// with the classic font and with GFXfont digits; the changed area is
+// reported by getDirtyRect() like in Adafruit_GFX_ButtonGroup.
+#define GFX_NUMBERFIELD_MAX  12 // Max slots in a field
+
+class Adafruit_GFX_NumberField {
+
+ public:
+  Adafruit_GFX_NumberField(void);
+  // x,y is where print() would start after setCursor(x,y): the top-left
+  // corner for the classic font, the left end of the baseline for a GFXfont.
+  // bg is needed to erase digits and must differ from color.
+  void    init(Adafruit_GFX *gfx, int16_t x, int16_t y, uint8_t slots,
+   uint16_t color, uint16_t bg, uint8_t textsize = 1, const GFXfont *f = NULL);
+
+  // Show text (left-aligned) or a number (right-aligned, zero padded to
+  // zeroPad digits), padded with spaces to the field size.  Selects the
+  // field's font on the display.  Returns the number of slots redrawn.
+  uint8_t setText(const char *s),
+          setValue(int32_t value, uint8_t zeroPad = 0);
+  void    invalidate(void);   // Redraw all slots on the next update
+  int16_t getSlotWidth(void); // In pixels, including textsize
+
+  // Get the area changed since the previous call.
+  // Returns false if nothing was drawn.
+  boolean getDirtyRect(int16_t *x, int16_t *y, uint16_t *w, uint16_t *h);
+
+ private:
+  uint8_t update(const char *s);
+  int8_t  glyphBox(uint8_t c, int8_t *x, int8_t *y, uint8_t *w, uint8_t *h);
+  void    addDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  Adafruit_GFX  *_gfx;
+  const GFXfont *_font;
+  int16_t  _x, _y;
+  uint16_t _color, _bg;
+  uint8_t  _slots, _slotW, _textsize;
+  char     _prev[GFX_NUMBERFIELD_MAX];  // Character shown in each slot
+  int8_t   _boxX[GFX_NUMBERFIELD_MAX],  // Its glyph box relative to the slot
+           _boxY[GFX_NUMBERFIELD_MAX];  // origin, in font pixels
+  uint8_t  _boxW[GFX_NUMBERFIELD_MAX],
+           _boxH[GFX_NUMBERFIELD_MAX];
+  int16_t  _dirtyX1, _dirtyY1, _dirtyX2, _dirtyY2;
+};
+
+// Lazy clear for RAM buffers (canvases and buffered displays).  With
+// setLazyClear(true), clearing the screen only marks the buffer rows as
+// pending.  A block of rows is filled with the clear color when it is
+// first drawn to, so rows that get redrawn anyway are not written twice
+// and rows nobody draws to cost nothing until they are read or flushed.
+// Buffer rows (unrotated) are grouped into at most 32 blocks of 8 or more
+// rows, so a block matches a page of the usual 1bpp display controllers.
+class GFXlazyClear {
+ public:
+  void    setLazyClear(boolean on);
+  boolean getLazyClear(void) const;
+
+ protected:
+  GFXlazyClear(uint16_t rows);
+  // Fill buffer rows y to y + n - 1 with color
+  virtual void fillRows(int16_t y, int16_t n, uint16_t color) = 0;
+  boolean lazyFill(uint16_t color); // true if the fill was deferred
+  void    lazyFlush(uint32_t blocks = 0xFFFFFFFF);
+  inline uint32_t lazyBlock(int16_t y) const {
+    return (uint32_t)1 << (y >> _lazyShift);
+  }
+  inline boolean lazyPending(int16_t y) const {
+    return _lazyPending && (_lazyPending & lazyBlock(y));
+  }
+  // Fill the block of buffer row y before it is drawn to
+  inline void lazyTouch(int16_t y) {
+    if(_lazyPending && (_lazyPending & lazyBlock(y))) lazyFlush(lazyBlock(y));
+  }
+
+  uint32_t _lazyPending;  // Blocks still to be filled with _lazyColor
+  uint16_t _lazyColor, _lazyRows;
+  uint8_t  _lazyShift;    // Rows per block is 1 << _lazyShift
+  boolean  _lazyOn;
+};
+
+// Double buffering for RAM buffers (canvases and buffered displays).  With
+// setDoubleBuffer(true) a front buffer keeps the frame that was flushed
+// last, while drawing goes on in the back buffer (the usual one).
+// flushChanges() compares both buffers a 32 bit word at a time, copies
+// only the runs of changed bytes to the front buffer and passes them from
+// there to a callback, row by row.  The front buffer stays stable until the
+// next flush, so a callback may keep the pointer (eg. for DMA) while the
+// next frame is drawn.  Without
+// double buffering (or after invalidateFront()) whole rows are passed.
+// Runs less than GFX_FLUSH_GAP equal bytes apart are merged, as starting a
+// transfer mostly costs more than a few bytes.  Offsets and lengths are in
+// bytes of a buffer row (unrotated), rounded to whole pixels.
+#ifndef GFX_FLUSH_GAP
+ #define GFX_FLUSH_GAP 4
+#endif
+
+typedef void (*GFXflushFunc)(void *arg, uint16_t row, uint16_t offset,
+  const uint8_t *data, uint16_t len);
+
+class GFXdoubleBuffer {
+ public:
+  ~GFXdoubleBuffer(void);
+  // False if the front buffer can't be allocated
+  boolean  setDoubleBuffer(boolean on);
+  boolean  getDoubleBuffer(void) const;
+  const uint8_t *getFrontBuffer(void) const;
+  // Pass everything at the next flush, eg. after the display was reset
+  void     invalidateFront(void);
+  // func may be NULL to only update the front buffer.  Returns the number
+  // of bytes passed.
+  uint32_t flushChanges(GFXflushFunc func, void *arg = NULL);
+
+ protected:
+  GFXdoubleBuffer(uint16_t rowBytes, uint16_t rows, uint8_t unit = 1);
+  // Back buffer with any pending lazy clear filled in
+  virtual uint8_t *backBuffer(void) = 0;
+
+  uint8_t  *_front;
+  uint16_t  _rowBytes, _rows;
+  uint8_t   _unit;        // Bytes per pixel
+  boolean   _frontValid;
+};
+
+// Threshold value for getRow1() that selects ordered dithering
+#define GFX_DITHER 0
+
+// Modes of GFXcanvas8::blit() and GFXcanvas16::blit(), which compose one
+// canvas onto another of the same type a row at a time, eg. a dynamic
+// overlay onto a copy of a static background.  Blits use buffer
+// coordinates (rotation is ignored, like in getRow565()) and are clipped
+// to both canvases.  The optional mask is a 1bpp bitmap of the size of the
+// source canvas, laid out like the GFXcanvas1 buffer; only pixels with a
+// set mask bit are drawn.  BLEND averages the RGB565 channels, or the
+// index values of GFXcanvas8 (gray levels without a palette).  src must
+// be another canvas than the destination.
+#define GFX_BLIT_COPY  0 // Source pixels replace destination pixels
+#define GFX_BLIT_KEY   1 // Source pixels equal to key are transparent
+#define GFX_BLIT_BLEND 2 // 50% mix of source and destination pixel
+
+// Color palette of the index canvases GFXcanvas8 and GFXcanvas4.  Pixels
+// are palette indexes.  At flush time a buffer row is converted through
+// the palette in one pass, to RGB565 (for drawRGBBitmap() or a TFT push)
+// or to 1bpp (for drawBitmap() or a page buffer).  In 1bpp rows the bits
+// of dark pixels are set, either below a threshold or with the 8x8
+// ordered dither of grayPattern().  Without a palette the indexes are
+// gray levels (0 is black, 255 or 15 is white).
+class GFXpalette {
+ public:
+  GFXpalette(uint8_t bits);
+  ~GFXpalette(void);
+  // The colors are not copied and must stay valid.  Their gray levels are
+  // kept in a table of count bytes; false if it can't be allocated.
+  // setPalette(NULL, 0) returns to gray levels.
+  boolean  setPalette(const uint16_t *colors, uint16_t count);
+  uint16_t getPaletteColor(uint8_t index) const;
+
+ protected:
+  // Convert w indexes from src, or w times fill when src is NULL
+  void
+    convertRow565(const uint8_t *src, uint8_t fill, int16_t w,
+      uint16_t *dst) const,
+    convertRow1(const uint8_t *src, uint8_t fill, int16_t w, int16_t y,
+      uint8_t *dst, uint8_t threshold) const;
+  uint8_t getPaletteGray(uint8_t index) const;
+
+  const uint16_t *_colors;
+  uint8_t        *_gray;
+  uint16_t        _count;
+  uint8_t         _bits;      // 8 or 4 bits per index
 };
 
-class GFXcanvas1 : public Adafruit_GFX {
+class GFXcanvas1 : public Adafruit_GFX, public GFXlazyClear,
+  public GFXdoubleBuffer {
  public:
   GFXcanvas1(uint16_t w, uint16_t h);
   ~GFXcanvas1(void);
@@ -200,34 +491,245 @@ class GFXcanvas1 : public Adafruit_GFX {
   void     drawPixel(int16_t x, int16_t y, uint16_t color),
            fillScreen(uint16_t color);
   uint8_t *getBuffer(void);
+ protected:
+  void     fillRows(int16_t y, int16_t n, uint16_t color);
+  uint8_t *backBuffer(void);
  private:
   uint8_t *buffer;
 };
 
-class GFXcanvas8 : public Adafruit_GFX {
+class GFXcanvas8 : public Adafruit_GFX, public GFXlazyClear,
+  public GFXpalette, public GFXdoubleBuffer {
  public:
   GFXcanvas8(uint16_t w, uint16_t h);
   ~GFXcanvas8(void);
   uint16_t getPixel(int16_t x, int16_t y);
   void     drawPixel(int16_t x, int16_t y, uint16_t color),
            fillScreen(uint16_t color),
-           writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+           writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           // Buffer row y (unrotated) as WIDTH colors or (WIDTH + 7) / 8
+           // bytes of 1bpp pixels
+           getRow565(int16_t y, uint16_t *dst),
+           getRow1(int16_t y, uint8_t *dst, uint8_t threshold = GFX_DITHER),
+           writeGraySpan(int16_t x, int16_t y, const uint8_t *colors,
+             int16_t w),
+           // Compose the w x h block at sx,sy of src (or all of src) onto
+           // this canvas at x,y, see GFX_BLIT_COPY
+           blit(const GFXcanvas8 &src, int16_t x, int16_t y,
+             uint8_t mode = GFX_BLIT_COPY, uint8_t key = 0,
+             const uint8_t *mask = NULL),
+           blit(const GFXcanvas8 &src, int16_t sx, int16_t sy, int16_t w,
+             int16_t h, int16_t x, int16_t y, uint8_t mode = GFX_BLIT_COPY,
+             uint8_t key = 0, const uint8_t *mask = NULL);
 
   uint8_t *getBuffer(void);
+ protected:
+  void     fillRows(int16_t y, int16_t n, uint16_t color);
+  uint8_t *backBuffer(void);
  private:
   uint8_t *buffer;
 };
 
-class GFXcanvas16 : public Adafruit_GFX {
+// Two pixels per byte (left pixel in the high nibble), for 16 color
+// palettes.  Same palette and row conversion as GFXcanvas8.
+class GFXcanvas4 : public Adafruit_GFX, public GFXlazyClear,
+  public GFXpalette, public GFXdoubleBuffer {
+ public:
+  GFXcanvas4(uint16_t w, uint16_t h);
+  ~GFXcanvas4(void);
+  uint16_t getPixel(int16_t x, int16_t y);
+  void     drawPixel(int16_t x, int16_t y, uint16_t color),
+           fillScreen(uint16_t color),
+           writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           getRow565(int16_t y, uint16_t *dst),
+           getRow1(int16_t y, uint8_t *dst, uint8_t threshold = GFX_DITHER);
+  uint8_t *getBuffer(void);
+ protected:
+  void     fillRows(int16_t y, int16_t n, uint16_t color);
+  uint8_t *backBuffer(void);
+ private:
+  uint8_t *buffer;
+};
+
+class GFXcanvas16 : public Adafruit_GFX, public GFXlazyClear,
+  public GFXdoubleBuffer {
  public:
   GFXcanvas16(uint16_t w, uint16_t h);
   ~GFXcanvas16(void);
   uint16_t getPixel(int16_t x, int16_t y);
   void      drawPixel(int16_t x, int16_t y, uint16_t color),
-            fillScreen(uint16_t color);
+            fillScreen(uint16_t color),
+            writeRGBSpan(int16_t x, int16_t y, const uint16_t *colors,
+              int16_t w),
+            blit(const GFXcanvas16 &src, int16_t x, int16_t y,
+              uint8_t mode = GFX_BLIT_COPY, uint16_t key = 0,
+              const uint8_t *mask = NULL),
+            blit(const GFXcanvas16 &src, int16_t sx, int16_t sy, int16_t w,
+              int16_t h, int16_t x, int16_t y, uint8_t mode = GFX_BLIT_COPY,
+              uint16_t key = 0, const uint8_t *mask = NULL);
   uint16_t *getBuffer(void);
+ protected:
+  void      fillRows(int16_t y, int16_t n, uint16_t color);
+  uint8_t  *backBuffer(void);
  private:
   uint16_t *buffer;
 };
 
+// GFXcanvas<W,H,DEPTH> is the statically sized counterpart of GFXcanvas1,
+// GFXcanvas8 and GFXcanvas16 (DEPTH = 1, 8 or 16).  The buffer is part of
+// the object instead of being malloc()ed in the constructor, so a global
+// canvas is listed in the "Global variables use..." report of the IDE and
+// doesn't fragment the heap.  As W and H are known at compile time, the
+// row stride is a constant and address calculation needs no multiply by
+// a variable.  Usage: GFXcanvas<84, 48, 1> canvas;
+template <uint16_t W, uint16_t H, uint8_t DEPTH> class GFXcanvas;
+
+template <uint16_t W, uint16_t H>
+class GFXcanvasStatic : public Adafruit_GFX, public GFXlazyClear {
+ public:
+  GFXcanvasStatic(void) : Adafruit_GFX(W, H), GFXlazyClear(H) { }
+ protected:
+  // Clip and map rotated (x,y) to raw buffer coordinates
+  inline boolean mapXY(int16_t &x, int16_t &y) const {
+    if((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return false;
+    int16_t t;
+    switch(rotation) {
+     case 1:
+      t = x;
+      x = W - 1 - y;
+      y = t;
+      break;
+     case 2:
+      x = W - 1 - x;
+      y = H - 1 - y;
+      break;
+     case 3:
+      t = x;
+      x = y;
+      y = H - 1 - t;
+      break;
+    }
+    return true;
+  }
+};
+
+template <uint16_t W, uint16_t H>
+class GFXcanvas<W, H, 1> : public GFXcanvasStatic<W, H> {
+ public:
+  enum { STRIDE = (W + 7) / 8, BYTES = STRIDE * H };
+  GFXcanvas(void) { memset(buffer, 0, BYTES); }
+  uint16_t getPixel(int16_t x, int16_t y) {
+    if(!this->mapXY(x, y)) return 0;
+    if(this->lazyPending(y)) return this->_lazyColor ? 1 : 0;
+    return (buffer[(x / 8) + y * STRIDE] & gfxBitMask(x & 7)) ? 1 : 0;
+  }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if(!this->mapXY(x, y)) return;
+    this->lazyTouch(y);
+    uint8_t *ptr = &buffer[(x / 8) + y * STRIDE];
+    if(color) *ptr |=  gfxBitMask(x & 7);
+    else      *ptr &= ~gfxBitMask(x & 7);
+  }
+  void fillScreen(uint16_t color) {
+    if(!this->lazyFill(color)) memset(buffer, color ? 0xFF : 0x00, BYTES);
+  }
+  uint8_t *getBuffer(void) {
+    this->lazyFlush();
+    return buffer;
+  }
+ protected:
+  void fillRows(int16_t y, int16_t n, uint16_t color) {
+    memset(buffer + y * STRIDE, color ? 0xFF : 0x00, n * STRIDE);
+  }
+ private:
+  uint8_t buffer[BYTES];
+};
+
+template <uint16_t W, uint16_t H>
+class GFXcanvas<W, H, 8> : public GFXcanvasStatic<W, H>, public GFXpalette {
+ public:
+  enum { STRIDE = W };
+  GFXcanvas(void) : GFXpalette(8) { memset(buffer, 0, sizeof(buffer)); }
+  uint16_t getPixel(int16_t x, int16_t y) {
+    if(!this->mapXY(x, y)) return 0;
+    if(this->lazyPending(y)) return (uint8_t)this->_lazyColor;
+    return buffer[x + y * STRIDE];
+  }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if(!this->mapXY(x, y)) return;
+    this->lazyTouch(y);
+    buffer[x + y * STRIDE] = color;
+  }
+  void fillScreen(uint16_t color) {
+    if(!this->lazyFill(color)) memset(buffer, color, sizeof(buffer));
+  }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if(this->rotation) { // Row is a column in the buffer, no memset
+      Adafruit_GFX::writeFastHLine(x, y, w, color);
+      return;
+    }
+    if((w <= 0) || (x >= W) || (y < 0) || (y >= H)) return;
+    int16_t x2 = x + w - 1;
+    if(x2 < 0) return;
+    if(x < 0)   x  = 0;     // Clip left/right
+    if(x2 >= W) x2 = W - 1;
+    this->lazyTouch(y);
+    memset(buffer + y * STRIDE + x, color, x2 - x + 1);
+  }
+  void getRow565(int16_t y, uint16_t *dst) {
+    this->convertRow565(this->lazyPending(y) ? NULL : buffer + y * STRIDE,
+      this->_lazyColor, W, dst);
+  }
+  void getRow1(int16_t y, uint8_t *dst, uint8_t threshold = GFX_DITHER) {
+    this->convertRow1(this->lazyPending(y) ? NULL : buffer + y * STRIDE,
+      this->_lazyColor, W, y, dst, threshold);
+  }
+  uint8_t *getBuffer(void) {
+    this->lazyFlush();
+    return buffer;
+  }
+ protected:
+  void fillRows(int16_t y, int16_t n, uint16_t color) {
+    memset(buffer + y * STRIDE, color, n * STRIDE);
+  }
+ private:
+  uint8_t buffer[(uint32_t)W * H];
+};
+
+template <uint16_t W, uint16_t H>
+class GFXcanvas<W, H, 16> : public GFXcanvasStatic<W, H> {
+ public:
+  enum { STRIDE = W };
+  GFXcanvas(void) { memset(buffer, 0, sizeof(buffer)); }
+  uint16_t getPixel(int16_t x, int16_t y) {
+    if(!this->mapXY(x, y)) return 0;
+    if(this->lazyPending(y)) return this->_lazyColor;
+    return buffer[x + y * STRIDE];
+  }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if(!this->mapXY(x, y)) return;
+    this->lazyTouch(y);
+    buffer[x + y * STRIDE] = color;
+  }
+  void fillScreen(uint16_t color) {
+    if(!this->lazyFill(color)) fillRows(0, H, color);
+  }
+  uint16_t *getBuffer(void) {
+    this->lazyFlush();
+    return buffer;
+  }
+ protected:
+  void fillRows(int16_t y, int16_t n, uint16_t color) {
+    uint8_t hi = color >> 8, lo = color & 0xFF;
+    if(hi == lo) {
+      memset(buffer + y * STRIDE, lo, (uint32_t)n * STRIDE * 2);
+    } else {
+      for(uint32_t i=0; i<(uint32_t)n * STRIDE; i++)
+        buffer[y * STRIDE + i] = color;
+    }
+  }
+ private:
+  uint16_t buffer[(uint32_t)W * H];
+};
+
 #endif // _ADAFRUIT_GFX_H
@@ -0,0 +1,700 @@
+#ifndef _ADAFRUIT_GFX_T_H
+#define _ADAFRUIT_GFX_T_H
+
+// Adafruit_GFX_T is a template (CRTP) variant of the Adafruit_GFX front-end.
+// It offers the classic drawing primitives, bitmaps (1-bit, XBM, grayscale
+// and RGB) and the Print-based text API with getTextBounds(), but calls
+// the pixel and span routines of the driver without going through virtual
+// functions.  This allows the compiler to inline the bit math of the driver
+// into the primitives, which is a big win on 8-bit AVR where every virtual
+// call costs an indirect jump plus saving and restoring registers.
+//
+// A driver derives from Adafruit_GFX_T<itself> and MUST define:
+//   void drawPixel(int16_t x, int16_t y, uint16_t color);
+// It MAY define optimized versions of (the generic ones are used otherwise):
+//   void startWrite(void), endWrite(void),
+//        writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+//        writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+//        fillScreen(uint16_t color);
+// These are plain (non-virtual) member functions; a driver function with the
+// same name and parameters hides the generic one.  Example:
+//
+//   class MyLCD : public Adafruit_GFX_T<MyLCD> {
+//    public:
+//     MyLCD(void) : Adafruit_GFX_T<MyLCD>(84, 48) { }
+//     void drawPixel(int16_t x, int16_t y, uint16_t color) { ... }
+//   };
+//
+// Only in Adafruit_GFX are the extensions of this library: pattern fills,
+// spans, dispCopy(), thick lines, Beziers, arcs, rotated and RLE bitmaps,
+// floodFill(), printFixed(), smooth text and auto scroll, invertDisplay()
+// and setDisplayStartLine().
+//
+// Since the primitives are instantiated per driver, this is meant for
+// sketches using a single display.  The 'classic' font is included from
+// glcdfont.c; when a sketch also uses Adafruit_GFX, both have their own copy.
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+ #include "Print.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "gfxfont.h"
+#include "GFXbackend.h"
+#include "glcdfont.c"
+
+template <class DRIVER>
+class Adafruit_GFX_T : public Print {
+
+ public:
+
+  Adafruit_GFX_T(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+    _width    = WIDTH;
+    _height   = HEIGHT;
+    rotation  = 0;
+    cursor_y  = cursor_x    = 0;
+    textsize  = 1;
+    textcolor = textbgcolor = 0xFFFF;
+    wrap      = true;
+    _cp437    = false;
+    gfxFont   = NULL;
+  }
+
+  // TRANSACTION API / CORE DRAW API
+  // May be hidden by the driver to provide device-specific optimized code.
+  inline void startWrite(void) { }
+  inline void endWrite(void) { }
+  inline void writePixel(int16_t x, int16_t y, uint16_t color) {
+    drv().drawPixel(x, y, color);
+  }
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    while(h-- > 0) drv().drawPixel(x, y++, color);
+  }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    while(w-- > 0) drv().drawPixel(x++, y, color);
+  }
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+    uint16_t color) {
+    for(int16_t j=0; j<h; j++) drv().writeFastHLine(x, y+j, w, color);
+  }
+  void fillScreen(uint16_t color) {
+    drv().startWrite();
+    drv().writeFillRect(0, 0, _width, _height, color);
+    drv().endWrite();
+  }
+
+  // Bresenham's algorithm - thx wikpedia
+  void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    uint16_t color) {
+    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+    if(steep) {
+      swap(x0, y0);
+      swap(x1, y1);
+    }
+    if(x0 > x1) {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+    int16_t dx = x1 - x0, dy = abs(y1 - y0);
+    int16_t err = dx / 2, ystep = (y0 < y1) ? 1 : -1;
+    for(; x0<=x1; x0++) {
+      if(steep) drv().drawPixel(y0, x0, color);
+      else      drv().drawPixel(x0, y0, color);
+      err -= dy;
+      if(err < 0) {
+        y0  += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  // BASIC DRAW API
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drv().startWrite();
+    drv().writeFastVLine(x, y, h, color);
+    drv().endWrite();
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    drv().startWrite();
+    drv().writeFastHLine(x, y, w, color);
+    drv().endWrite();
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drv().startWrite();
+    drv().writeFillRect(x, y, w, h, color);
+    drv().endWrite();
+  }
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    uint16_t color) {
+    if(x0 == x1) {
+      if(y0 > y1) swap(y0, y1);
+      drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if(y0 == y1) {
+      if(x0 > x1) swap(x0, x1);
+      drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+      drv().startWrite();
+      writeLine(x0, y0, x1, y1, color);
+      drv().endWrite();
+    }
+  }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drv().startWrite();
+    drv().writeFastHLine(x, y, w, color);
+    drv().writeFastHLine(x, y+h-1, w, color);
+    drv().writeFastVLine(x, y, h, color);
+    drv().writeFastVLine(x+w-1, y, h, color);
+    drv().endWrite();
+  }
+
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+    drv().startWrite();
+    drv().drawPixel(x0  , y0+r, color);
+    drv().drawPixel(x0  , y0-r, color);
+    drv().drawPixel(x0+r, y0  , color);
+    drv().drawPixel(x0-r, y0  , color);
+    while(x<y) {
+      if(f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+      drv().drawPixel(x0 + x, y0 + y, color);
+      drv().drawPixel(x0 - x, y0 + y, color);
+      drv().drawPixel(x0 + x, y0 - y, color);
+      drv().drawPixel(x0 - x, y0 - y, color);
+      drv().drawPixel(x0 + y, y0 + x, color);
+      drv().drawPixel(x0 - y, y0 + x, color);
+      drv().drawPixel(x0 + y, y0 - x, color);
+      drv().drawPixel(x0 - y, y0 - x, color);
+    }
+    drv().endWrite();
+  }
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+    uint16_t color) {
+    int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+    while(x<y) {
+      if(f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+      if(cornername & 0x4) {
+        drv().drawPixel(x0 + x, y0 + y, color);
+        drv().drawPixel(x0 + y, y0 + x, color);
+      }
+      if(cornername & 0x2) {
+        drv().drawPixel(x0 + x, y0 - y, color);
+        drv().drawPixel(x0 + y, y0 - x, color);
+      }
+      if(cornername & 0x8) {
+        drv().drawPixel(x0 - y, y0 + x, color);
+        drv().drawPixel(x0 - x, y0 + y, color);
+      }
+      if(cornername & 0x1) {
+        drv().drawPixel(x0 - y, y0 - x, color);
+        drv().drawPixel(x0 - x, y0 - y, color);
+      }
+    }
+  }
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    drv().startWrite();
+    drv().writeFastVLine(x0, y0-r, 2*r+1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+    drv().endWrite();
+  }
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+    int16_t delta, uint16_t color) {
+    int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+    while(x<y) {
+      if(f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+      if(cornername & 0x1) {
+        drv().writeFastVLine(x0+x, y0-y, 2*y+1+delta, color);
+        drv().writeFastVLine(x0+y, y0-x, 2*x+1+delta, color);
+      }
+      if(cornername & 0x2) {
+        drv().writeFastVLine(x0-x, y0-y, 2*y+1+delta, color);
+        drv().writeFastVLine(x0-y, y0-x, 2*x+1+delta, color);
+      }
+    }
+  }
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+    uint16_t color) {
+    drv().startWrite();
+    drv().writeFastHLine(x+r  , y    , w-2*r, color); // Top
+    drv().writeFastHLine(x+r  , y+h-1, w-2*r, color); // Bottom
+    drv().writeFastVLine(x    , y+r  , h-2*r, color); // Left
+    drv().writeFastVLine(x+w-1, y+r  , h-2*r, color); // Right
+    drawCircleHelper(x+r    , y+r    , r, 1, color);
+    drawCircleHelper(x+w-r-1, y+r    , r, 2, color);
+    drawCircleHelper(x+w-r-1, y+h-r-1, r, 4, color);
+    drawCircleHelper(x+r    , y+h-r-1, r, 8, color);
+    drv().endWrite();
+  }
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+    uint16_t color) {
+    drv().startWrite();
+    drv().writeFillRect(x+r, y, w-2*r, h, color);
+    fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
+    fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+    drv().endWrite();
+  }
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    int16_t x2, int16_t y2, uint16_t color) {
+    drawLine(x0, y0, x1, y1, color);
+    drawLine(x1, y1, x2, y2, color);
+    drawLine(x2, y2, x0, y0, color);
+  }
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    int16_t x2, int16_t y2, uint16_t color) {
+    int16_t a, b, y, last;
+    // Sort coordinates by Y order (y2 >= y1 >= y0)
+    if(y0 > y1) { swap(y0, y1); swap(x0, x1); }
+    if(y1 > y2) { swap(y2, y1); swap(x2, x1); }
+    if(y0 > y1) { swap(y0, y1); swap(x0, x1); }
+
+    drv().startWrite();
+    if(y0 == y2) { // All on same line
+      a = b = x0;
+      if(x1 < a)      a = x1;
+      else if(x1 > b) b = x1;
+      if(x2 < a)      a = x2;
+      else if(x2 > b) b = x2;
+      drv().writeFastHLine(a, y0, b-a+1, color);
+      drv().endWrite();
+      return;
+    }
+    int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0,
+            dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+    // See Adafruit_GFX::fillTriangle() for the scanline logic
+    if(y1 == y2) last = y1;   // Include y1 scanline
+    else         last = y1-1; // Skip it
+    for(y=y0; y<=last; y++) {
+      a   = x0 + sa / dy01;
+      b   = x0 + sb / dy02;
+      sa += dx01;
+      sb += dx02;
+      if(a > b) swap(a, b);
+      drv().writeFastHLine(a, y, b-a+1, color);
+    }
+    sa = (int32_t)dx12 * (y - y1);
+    sb = (int32_t)dx02 * (y - y0);
+    for(; y<=y2; y++) {
+      a   = x1 + sa / dy12;
+      b   = x0 + sb / dy02;
+      sa += dx12;
+      sb += dx02;
+      if(a > b) swap(a, b);
+      drv().writeFastHLine(a, y, b-a+1, color);
+    }
+    drv().endWrite();
+  }
+
+  // Draw a PROGMEM-resident 1-bit image, unset bits are transparent
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+    int16_t w, int16_t h, uint16_t color) {
+    GFXflashReader rd(bitmap); // Rows are read in order, pad bytes too
+    uint8_t byte = 0;
+    drv().startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+      for(int16_t i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = rd.read();
+        if(byte & 0x80) drv().drawPixel(x+i, y, color);
+      }
+    }
+    drv().endWrite();
+  }
+  // Draw a PROGMEM-resident 1-bit image using foreground and background
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+    int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    GFXflashReader rd(bitmap); // Rows are read in order, pad bytes too
+    uint8_t byte = 0;
+    drv().startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+      for(int16_t i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = rd.read();
+        drv().drawPixel(x+i, y, (byte & 0x80) ? color : bg);
+      }
+    }
+    drv().endWrite();
+  }
+  // Draw a RAM-resident 1-bit image, unset bits are transparent
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+    int16_t w, int16_t h, uint16_t color) {
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t byte = 0;
+    drv().startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+      for(int16_t i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = bitmap[j * byteWidth + i / 8];
+        if(byte & 0x80) drv().drawPixel(x+i, y, color);
+      }
+    }
+    drv().endWrite();
+  }
+  // Draw a RAM-resident 1-bit image using foreground and background
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+    int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t byte = 0;
+    drv().startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+      for(int16_t i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = bitmap[j * byteWidth + i / 8];
+        drv().drawPixel(x+i, y, (byte & 0x80) ? color : bg);
+      }
+    }
+    drv().endWrite();
+  }
+  // Draw PROGMEM-resident XBitMap Files (*.xbm), exported from GIMP
+  void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+    int16_t w, int16_t h, uint16_t color) {
+    GFXflashReader rd(bitmap); // Rows are read in order, pad bytes too
+    uint8_t byte = 0;
+    drv().startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+      for(int16_t i=0; i<w; i++) {
+        if(i & 7) byte >>= 1;
+        else      byte   = rd.read();
+        if(byte & 0x01) drv().drawPixel(x+i, y, color);
+      }
+    }
+    drv().endWrite();
+  }
+
+  // 8-bit (grayscale) and 16-bit (RGB 5/6/5) images, in PROGMEM (const)
+  // or RAM, optionally with a 1-bit mask in the same memory (set bits are
+  // opaque).  No color reduction/expansion is performed.
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+    int16_t w, int16_t h) {
+    drawPixels<uint8_t, true>(x, y, bitmap, NULL, w, h);
+  }
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+    int16_t w, int16_t h) {
+    drawPixels<uint8_t, false>(x, y, bitmap, NULL, w, h);
+  }
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+    const uint8_t mask[], int16_t w, int16_t h) {
+    drawPixels<uint8_t, true>(x, y, bitmap, mask, w, h);
+  }
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+    uint8_t *mask, int16_t w, int16_t h) {
+    drawPixels<uint8_t, false>(x, y, bitmap, mask, w, h);
+  }
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+    int16_t w, int16_t h) {
+    drawPixels<uint16_t, true>(x, y, bitmap, NULL, w, h);
+  }
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
+    int16_t w, int16_t h) {
+    drawPixels<uint16_t, false>(x, y, bitmap, NULL, w, h);
+  }
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+    const uint8_t mask[], int16_t w, int16_t h) {
+    drawPixels<uint16_t, true>(x, y, bitmap, mask, w, h);
+  }
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
+    uint8_t *mask, int16_t w, int16_t h) {
+    drawPixels<uint16_t, false>(x, y, bitmap, mask, w, h);
+  }
+
+  // TEXT- AND CHARACTER-HANDLING FUNCTIONS
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+    uint16_t bg, uint8_t size) {
+    if(!gfxFont) { // 'Classic' built-in font
+      if((x >= _width)            || // Clip right
+         (y >= _height)           || // Clip bottom
+         ((x + 6 * size - 1) < 0) || // Clip left
+         ((y + 8 * size - 1) < 0))   // Clip top
+        return;
+      if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+      GFXflashReader rd(&font[c * 5]);
+      drv().startWrite();
+      for(int8_t i=0; i<5; i++) { // Char bitmap = 5 columns
+        uint8_t line = rd.read();
+        for(int8_t j=0; j<8; j++, line >>= 1) {
+          if(line & 1) {
+            if(size == 1) drv().drawPixel(x+i, y+j, color);
+            else drv().writeFillRect(x+i*size, y+j*size, size, size, color);
+          } else if(bg != color) {
+            if(size == 1) drv().drawPixel(x+i, y+j, bg);
+            else drv().writeFillRect(x+i*size, y+j*size, size, size, bg);
+          }
+        }
+      }
+      if(bg != color) { // If opaque, draw vertical line for last column
+        if(size == 1) drv().writeFastVLine(x+5, y, 8, bg);
+        else          drv().writeFillRect(x+5*size, y, size, 8*size, bg);
+      }
+      drv().endWrite();
+    } else { // Custom font, no background color (see Adafruit_GFX.cpp)
+      GFXglyph *glyph  = fontGlyph(c);
+      if(!glyph) return;
+      uint8_t  *bitmap = (uint8_t *)pgm_read_pointer(&gfxFont->bitmap);
+      GFXflashReader rd(&bitmap[pgm_read_word(&glyph->bitmapOffset)]);
+      uint8_t  w  = pgm_read_byte(&glyph->width),
+               h  = pgm_read_byte(&glyph->height);
+      int8_t   xo = pgm_read_byte(&glyph->xOffset),
+               yo = pgm_read_byte(&glyph->yOffset);
+      uint8_t  xx, yy, bits = 0, bit = 0;
+      boolean  rowAligned =
+        pgm_read_byte(&gfxFont->flags) & GFX_FONT_ROWALIGNED;
+      drv().startWrite();
+      for(yy=0; yy<h; yy++) {
+        if(rowAligned) bit = 0; // Skip the pad bits, row starts a new byte
+        for(xx=0; xx<w; xx++) {
+          if(!(bit++ & 7)) bits = rd.read();
+          if(bits & 0x80) {
+            if(size == 1) drv().drawPixel(x+xo+xx, y+yo+yy, color);
+            else drv().writeFillRect(x+(xo+xx)*size, y+(yo+yy)*size,
+                   size, size, color);
+          }
+          bits <<= 1;
+        }
+      }
+      drv().endWrite();
+    }
+  }
+
+#if ARDUINO >= 100
+  virtual size_t write(uint8_t c) {
+#else
+  virtual void   write(uint8_t c) {
+#endif
+    if(!gfxFont) { // 'Classic' built-in font
+      if(c == '\n') {
+        cursor_x  = 0;
+        cursor_y += textsize * 8;
+      } else if(c != '\r') {
+        // Wrap like Adafruit_GFX::checkScrollWrap(): the last column is blank
+        if(wrap && ((cursor_x + textsize * 4) > _width)) { // Off right?
+          cursor_x  = 0;
+          cursor_y += textsize * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+        cursor_x += textsize * 6;
+      }
+    } else { // Custom font
+      if(c == '\n') {
+        cursor_x  = 0;
+        cursor_y += (int16_t)textsize *
+                    (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+      } else if(c != '\r') {
+        GFXglyph *glyph = fontGlyph(c);
+        if(glyph) {
+          uint8_t   w     = pgm_read_byte(&glyph->width),
+                    h     = pgm_read_byte(&glyph->height);
+          if((w > 0) && (h > 0)) { // Is there an associated bitmap?
+            int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+            if(wrap && ((cursor_x + textsize * (xo + w)) > _width)) {
+              cursor_x  = 0;
+              cursor_y += (int16_t)textsize *
+                          (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+            }
+            drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+          }
+          cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance) *
+                      (int16_t)textsize;
+        }
+      }
+    }
+#if ARDUINO >= 100
+    return 1;
+#endif
+  }
+
+  // Pass string and a cursor position, returns UL corner and W,H
+  void getTextBounds(char *str, int16_t x, int16_t y,
+    int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+    int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+    uint8_t c;
+    *x1 = x;
+    *y1 = y;
+    while((c = *str++)) charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    setBounds(minx, miny, maxx, maxy, x1, y1, w, h);
+  }
+  // Same as above, but for PROGMEM strings
+  void getTextBounds(const __FlashStringHelper *str, int16_t x, int16_t y,
+    int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+    const uint8_t *s = (const uint8_t *)str;
+    int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+    uint8_t c;
+    *x1 = x;
+    *y1 = y;
+    while((c = pgm_read_byte(s++)))
+      charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    setBounds(minx, miny, maxx, maxy, x1, y1, w, h);
+  }
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  int16_t getCursorX(void) const { return cursor_x; }
+  int16_t getCursorY(void) const { return cursor_y; }
+  void setTextSize(uint8_t s) { textsize = (s > 0) ? s : 1; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t b) { textcolor = c; textbgcolor = b; }
+  void setTextWrap(boolean w) { wrap = w; }
+  void cp437(boolean x=true) { _cp437 = x; }
+  void setFont(const GFXfont *f = NULL) {
+    if(f) {            // Font struct pointer passed in?
+      if(!gfxFont) {   // And no current font struct?
+        cursor_y += 6; // Switching from classic to new font, move to baseline
+      }
+    } else if(gfxFont) { // NULL passed.  Current font struct defined?
+      cursor_y -= 6;     // Switching from new to classic font
+    }
+    gfxFont = (GFXfont *)f;
+  }
+
+  void setRotation(uint8_t r) {
+    rotation = (r & 3);
+    if(rotation & 1) {
+      _width  = HEIGHT;
+      _height = WIDTH;
+    } else {
+      _width  = WIDTH;
+      _height = HEIGHT;
+    }
+  }
+  uint8_t getRotation(void) const { return rotation; }
+  int16_t width(void) const { return _width; }
+  int16_t height(void) const { return _height; }
+
+ protected:
+  inline DRIVER &drv(void) { return *static_cast<DRIVER *>(this); }
+  static inline void swap(int16_t &a, int16_t &b) { int16_t t = a; a = b; b = t; }
+
+  // Shared by the grayscale and RGB bitmaps, T is the pixel type
+  template <typename T, bool PGM>
+  void drawPixels(int16_t x, int16_t y, const T *bitmap, const uint8_t *mask,
+    int16_t w, int16_t h) {
+    int16_t bw   = (w + 7) / 8; // Bitmask scanline pad = whole byte
+    uint8_t byte = 0x80;
+    drv().startWrite();
+    for(int16_t j=0; j<h; j++, y++) {
+      for(int16_t i=0; i<w; i++) {
+        if(mask) {
+          if(i & 7) byte <<= 1;
+          else      byte   = PGM ? pgm_read_byte(&mask[j * bw + i / 8]) :
+                                   mask[j * bw + i / 8];
+          if(!(byte & 0x80)) continue;
+        }
+        const T *p = &bitmap[j * w + i];
+        drv().drawPixel(x+i, y, !PGM ? *p : (sizeof(T) == 1) ?
+          (uint16_t)pgm_read_byte(p) : (uint16_t)pgm_read_word(p));
+      }
+    }
+    drv().endWrite();
+  }
+
+  // Extend the bounds by char c at *x,*y and advance like write() does
+  void charBounds(uint8_t c, int16_t *x, int16_t *y,
+    int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy) {
+    if(!gfxFont) { // 'Classic' built-in font
+      if(c == '\n') {
+        *x  = 0;
+        *y += textsize * 8;
+      } else if(c != '\r') {
+        if(wrap && ((*x + textsize * 4) > _width)) { // Same wrap as write()
+          *x  = 0;
+          *y += textsize * 8;
+        }
+        int16_t x2 = *x + textsize * 6 - 1, // Lower-right pixel of char
+                y2 = *y + textsize * 8 - 1;
+        if(x2 > *maxx) *maxx = x2;
+        if(y2 > *maxy) *maxy = y2;
+        if(*x < *minx) *minx = *x;
+        if(*y < *miny) *miny = *y;
+        *x += textsize * 6;
+      }
+    } else { // Custom font
+      if(c == '\n') {
+        *x  = 0;
+        *y += (int16_t)textsize * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+      } else if(c != '\r') {
+        GFXglyph *glyph = fontGlyph(c);
+        if(!glyph) return;
+        uint8_t gw = pgm_read_byte(&glyph->width),
+                gh = pgm_read_byte(&glyph->height);
+        int16_t ts = textsize,
+                xo = (int8_t)pgm_read_byte(&glyph->xOffset),
+                yo = (int8_t)pgm_read_byte(&glyph->yOffset);
+        if((gw > 0) && (gh > 0)) {
+          if(wrap && ((*x + ts * (xo + gw)) > _width)) {
+            *x  = 0;
+            *y += ts * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+          }
+          int16_t x1 = *x + xo * ts, y1 = *y + yo * ts,
+                  x2 = x1 + gw * ts - 1, y2 = y1 + gh * ts - 1;
+          if(x1 < *minx) *minx = x1;
+          if(y1 < *miny) *miny = y1;
+          if(x2 > *maxx) *maxx = x2;
+          if(y2 > *maxy) *maxy = y2;
+        }
+        *x += (uint8_t)pgm_read_byte(&glyph->xAdvance) * ts;
+      }
+    }
+  }
+  // UL corner and W,H of the bounds, *x1,*y1 are kept if they are empty
+  static void setBounds(int16_t minx, int16_t miny, int16_t maxx,
+    int16_t maxy, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+    *w  = *h = 0;
+    if(maxx >= minx) {
+      *x1 = minx;
+      *w  = maxx - minx + 1;
+    }
+    if(maxy >= miny) {
+      *y1 = miny;
+      *h  = maxy - miny + 1;
+    }
+  }
+
+  // Glyph of char c in the current font, NULL if it has none
+  GFXglyph *fontGlyph(uint8_t c) {
+    uint8_t first = pgm_read_byte(&gfxFont->first);
+    if((c < first) || (c > (uint8_t)pgm_read_byte(&gfxFont->last))) return NULL;
+    c -= first;
+    if(pgm_read_byte(&gfxFont->flags) & GFX_FONT_REMAP) { // Subset font
+      c = pgm_read_byte(&((uint8_t *)pgm_read_pointer(&gfxFont->map))[c]);
+      if(c == 0xFF) return NULL;
+    }
+    return &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
+  }
+
+  const int16_t
+    WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
+  int16_t
+    _width, _height, // Display w/h as modified by current rotation
+    cursor_x, cursor_y;
+  uint16_t
+    textcolor, textbgcolor;
+  uint8_t
+    textsize,
+    rotation;
+  boolean
+    wrap,   // If set, 'wrap' text at right edge of display
+    _cp437; // If set, use correct CP437 charset (default is off)
+  GFXfont
+    *gfxFont;
+};
+
+#endif // _ADAFRUIT_GFX_T_H
@@ -0,0 +1,142 @@
+/*
+Scrolling text console for Adafruit_GFX displays.
+
+Lines of text are kept in a ring buffer of _rows x _cols characters, so a
+new line is added by moving the ring start instead of copying text. If the
+display supports setDisplayStartLine(), the framebuffer is used as a ring of
+text rows as well: scrolling clears one row band and moves the start line,
+which takes the same time regardless of screen size. Displays without row
+remapping get the visible lines redrawn from the line buffer.
+*/
+
+#include "GFXconsole.h"
+
+GFXconsole::GFXconsole(Adafruit_GFX *gfx, uint8_t textsize) {
+  _gfx      = gfx;
+  _size     = (textsize > 0) ? textsize : 1;
+  _lines    = NULL;
+  _fg       = 0xFFFF;
+  _bg       = 0;
+  _cols     = _rows = 0;
+  _first    = _row = _col = 0;
+  _hwScroll = false;
+}
+
+GFXconsole::~GFXconsole(void) {
+  if(_lines) free(_lines);
+}
+
+boolean GFXconsole::begin(void) {
+  int16_t lh = 8 * _size;
+
+  if(_lines) {
+    free(_lines);
+    _lines = NULL;
+  }
+  _cols = _gfx->width()  / (6 * _size);
+  _rows = _gfx->height() / lh;
+  if(!_cols || !_rows) return false;
+  if(!(_lines = (char *)malloc(_cols * _rows))) return false;
+
+  // The framebuffer can only be used as a ring when the text rows tile the
+  // display exactly and the display accepts every row start as start line.
+  _hwScroll = ((_gfx->height() % lh) == 0) &&
+              ((_rows < 2) || _gfx->setDisplayStartLine(lh)) &&
+              _gfx->setDisplayStartLine(0);
+
+  _gfx->setFont();  // console uses the classic 6x8 font
+  clear();
+  return true;
+}
+
+void GFXconsole::setTextColor(uint16_t c, uint16_t bg) {
+  _fg = c;
+  _bg = bg;
+}
+
+void GFXconsole::clear(void) {
+  if(!_lines) return;
+  memset(_lines, ' ', _cols * _rows);
+  _first = _row = _col = 0;
+  if(_hwScroll) _gfx->setDisplayStartLine(0);
+  _gfx->fillScreen(_bg);
+}
+
+uint8_t GFXconsole::getCols(void) const {
+  return _cols;
+}
+
+uint8_t GFXconsole::getRows(void) const {
+  return _rows;
+}
+
+boolean GFXconsole::hasHardwareScroll(void) const {
+  return _hwScroll;
+}
+
+// Text of visible row 'row' in the line ring
+char *GFXconsole::line(uint8_t row) const {
+  uint8_t r = _first + row;
+  if(r >= _rows) r -= _rows;
+  return _lines + r * _cols;
+}
+
+// Framebuffer y of visible row 'row'
+int16_t GFXconsole::rowY(uint8_t row) const {
+  uint8_t r = row;
+  if(_hwScroll) {
+    r += _first;
+    if(r >= _rows) r -= _rows;
+  }
+  return r * 8 * _size;
+}
+
+void GFXconsole::drawRow(uint8_t row) {
+  int16_t y = rowY(row);
+  char   *t = line(row);
+
+  _gfx->fillRect(0, y, _cols * 6 * _size, 8 * _size, _bg);
+  for(uint8_t c=0; c<_cols; c++) {
+    if(t[c] != ' ') // background already cleared, draw transparent
+      _gfx->drawChar(c * 6 * _size, y, t[c], _fg, _fg, _size);
+  }
+}
+
+void GFXconsole::newLine(void) {
+  _col = 0;
+  if(_row < _rows - 1) {
+    _row++;
+    return;
+  }
+
+  // Bottom reached: the top line becomes the new (empty) bottom line
+  if(++_first >= _rows) _first = 0;
+  memset(line(_rows - 1), ' ', _cols);
+
+  if(_hwScroll) {
+    _gfx->fillRect(0, rowY(_rows - 1), _gfx->width(), 8 * _size, _bg);
+    _gfx->setDisplayStartLine(_first * 8 * _size);
+  } else {
+    for(uint8_t r=0; r<_rows; r++) drawRow(r);
+  }
+}
+
+#if ARDUINO >= 100
+size_t GFXconsole::write(uint8_t c) {
+#else
+void GFXconsole::write(uint8_t c) {
+#endif
+  if(_lines) {
+    if(c == '\n') {
+      newLine();
+    } else if(c != '\r') {
+      if(_col >= _cols) newLine(); // wrap only when there is more text
+      line(_row)[_col] = c;
+      _gfx->drawChar(_col * 6 * _size, rowY(_row), c, _fg, _bg, _size);
+      _col++;
+    }
+  }
+#if ARDUINO >= 100
+  return 1;
+#endif
+}
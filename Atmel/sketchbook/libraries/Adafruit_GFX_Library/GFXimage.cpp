@@ -0,0 +1,376 @@
+/*
+Streaming image decoder for Adafruit_GFX displays.
+
+The stream is read through a buffer of GFX_IMAGE_CHUNK bytes. Each image
+row is decoded into a row of ink bits, which is drawn as runs with
+writeFastHLine() before the next row is read. Besides the read buffer the
+only RAM used is that row and, for palette images, one gray level per
+palette entry.
+
+BMP rows are usually stored bottom-up. They are drawn in file order, so
+the image builds up from the bottom; no row is read twice.
+
+Pixels are dithered in screen coordinates, so images drawn next to each
+other or next to grayPattern() fills continue the same pattern.
+*/
+
+#include "GFXimage.h"
+
+// Entry of the 8x8 Bayer matrix: the bits of x^y and y interleaved and
+// reversed. This gives the same matrix as the one used by grayPattern().
+static inline uint8_t bayer(uint8_t x, uint8_t y) {
+  uint8_t v = x ^ y;
+  return ((v & 1) << 5) | ((y & 1) << 4) | ((v & 2) << 2) |
+         ((y & 2) << 1) | ((v & 4) >> 1) | ((y & 4) >> 2);
+}
+
+static uint32_t readLE(const uint8_t *p, uint8_t n) {
+  uint32_t v = 0;
+  while(n--) v = (v << 8) | p[n];
+  return v;
+}
+
+GFXimage::GFXimage(Adafruit_GFX *gfx) {
+  _gfx    = gfx;
+  _stream = NULL;
+  _row    = _pal = NULL;
+  _error  = GFX_IMAGE_OK;
+  _w      = _h = 0;
+  _bytes  = _micros = 0;
+}
+
+uint8_t GFXimage::getError(void) const {
+  return _error;
+}
+
+int16_t GFXimage::width(void) const {
+  return _w;
+}
+
+int16_t GFXimage::height(void) const {
+  return _h;
+}
+
+uint32_t GFXimage::getBytes(void) const {
+  return _bytes;
+}
+
+uint32_t GFXimage::getMicros(void) const {
+  return _micros;
+}
+
+uint32_t GFXimage::getBytesPerSecond(void) const {
+  return _micros ? (uint32_t)((uint64_t)_bytes * 1000000 / _micros) : 0;
+}
+
+boolean GFXimage::draw(Stream *s, int16_t x, int16_t y, uint16_t color,
+  uint16_t bg) {
+  uint32_t start = micros();
+  int16_t  c1, c2;
+
+  _stream  = s;
+  _pos     = _len = 0;
+  _bytes   = 0;
+  _x       = x;
+  _y       = y;
+  _w       = _h = 0;
+  _color   = color;
+  _bg      = bg;
+  _mono    = -1;
+  _rle     = 0;
+  _rleCol  = _rleSkip = 0;
+  _error   = GFX_IMAGE_OK;
+
+  c1 = read();
+  c2 = read();
+  _gfx->startWrite();
+  if((c1 == 'P') && ((c2 == '4') || (c2 == '5'))) drawPNM(c2);
+  else if((c1 == 'B') && (c2 == 'M'))             drawBMP();
+  else fail((c1 < 0) ? GFX_IMAGE_TRUNCATED : GFX_IMAGE_FORMAT);
+  _gfx->endWrite();
+
+  if(_row) free(_row);
+  if(_pal) free(_pal);
+  _row = _pal = NULL;
+  _micros = micros() - start;
+  return _error == GFX_IMAGE_OK;
+}
+
+boolean GFXimage::fail(uint8_t error) {
+  if(_error == GFX_IMAGE_OK) _error = error;
+  return false;
+}
+
+// Binary PBM (1 is black) or 8 bit PGM (0 is black)
+boolean GFXimage::drawPNM(char type) {
+  int32_t w = readNumber(), h = readNumber(), maxval = 1;
+
+  if(type == '5') maxval = readNumber();
+  if((w <= 0) || (h <= 0) || (maxval <= 0) || (maxval > 255))
+    return fail(GFX_IMAGE_FORMAT);
+  _w = w;
+  _h = h;
+  if(type == '4') {
+    _bpp    = 1;
+    _mono   = 0;
+    _stride = (w + 7) / 8;
+  } else {
+    _bpp    = 8;
+    _stride = w;
+    if(!(_pal = (uint8_t *)malloc(256))) return fail(GFX_IMAGE_NOMEM);
+    for(int16_t i=0; i<256; i++)
+      _pal[i] = (i >= maxval) ? 255 :
+                ((uint16_t)i * 255 + maxval / 2) / maxval;
+  }
+  if(!allocRow()) return false;
+  for(int16_t row=0; row<_h; row++) {
+    if(!readRow(row)) return false;
+    drawRow(row);
+  }
+  return true;
+}
+
+// Windows BMP, 1/4/8 bit palette or 24 bit, uncompressed or RLE4/RLE8
+boolean GFXimage::drawBMP(void) {
+  uint8_t  hdr[36];
+  uint32_t offset, size, compression = 0, colors = 0;
+  int32_t  w, h;
+  uint8_t  entry = 4; // Bytes per palette entry
+
+  // Rest of the file header and the size of the info header
+  if(!readHeader(hdr, 16)) return false;
+  offset = readLE(hdr + 8, 4);
+  size   = readLE(hdr + 12, 4);
+  if(size == 12) {  // OS/2 core header
+    if(!readHeader(hdr, 8)) return false;
+    w     = (int16_t)readLE(hdr, 2);
+    h     = (int16_t)readLE(hdr + 2, 2);
+    _bpp  = readLE(hdr + 6, 2);
+    entry = 3;
+  } else if(size >= 40) {
+    if(!readHeader(hdr, 36)) return false;
+    w           = (int32_t)readLE(hdr, 4);
+    h           = (int32_t)readLE(hdr + 4, 4);
+    _bpp        = readLE(hdr + 10, 2);
+    compression = readLE(hdr + 12, 4);
+    colors      = readLE(hdr + 28, 4);
+    if(!skipTo(14 + size)) return false;  // V4/V5 header fields
+  } else {
+    return fail(GFX_IMAGE_FORMAT);
+  }
+
+  if((w <= 0) || (w > 0x7FFF) || (h == 0) || (h < -0x7FFF) || (h > 0x7FFF))
+    return fail(GFX_IMAGE_FORMAT);
+  if((_bpp != 1) && (_bpp != 4) && (_bpp != 8) && (_bpp != 24))
+    return fail(GFX_IMAGE_FORMAT);
+  if((compression == 1) && (_bpp == 8))      _rle = 1;
+  else if((compression == 2) && (_bpp == 4)) _rle = 1;
+  else if(compression)                       return fail(GFX_IMAGE_FORMAT);
+  _w      = w;
+  _h      = (h < 0) ? -h : h;
+  _stride = (((uint32_t)w * _bpp + 31) / 32) * 4;
+
+  if(_bpp <= 8) {
+    uint16_t n = 1 << _bpp;
+
+    if(!colors) colors = n;
+    if(colors > n) return fail(GFX_IMAGE_FORMAT);
+    if(!(_pal = (uint8_t *)calloc(n, 1))) return fail(GFX_IMAGE_NOMEM);
+    for(uint16_t i=0; i<colors; i++) {
+      if(!readHeader(hdr, entry)) return false;
+      _pal[i] = (hdr[0] * 29 + hdr[1] * 150 + hdr[2] * 77) >> 8;
+    }
+    // Black and white 1bpp rows don't need dithering
+    if((_bpp == 1) && !(_pal[0] % 255) && !(_pal[1] % 255) &&
+       (_pal[0] != _pal[1]))
+      _mono = _pal[0] ? 0 : 0xFF;
+  }
+  if(!skipTo(offset) || !allocRow()) return false;
+
+  // Positive heights are stored bottom-up
+  int16_t row = (h < 0) ? 0 : _h - 1,
+          dy  = (h < 0) ? 1 : -1;
+  for(int16_t n=0; n<_h; n++, row += dy) {
+    if(!(_rle ? readRowRLE(row) : readRow(row))) return false;
+    drawRow(row);
+  }
+  return true;
+}
+
+boolean GFXimage::allocRow(void) {
+  if(!(_row = (uint8_t *)malloc((_w + 7) / 8))) return fail(GFX_IMAGE_NOMEM);
+  return true;
+}
+
+boolean GFXimage::readHeader(uint8_t *buf, uint8_t len) {
+  int16_t c;
+
+  while(len--) {
+    if((c = read()) < 0) return fail(GFX_IMAGE_TRUNCATED);
+    *buf++ = c;
+  }
+  return true;
+}
+
+// Skip forward to a file offset, the stream can't go back
+boolean GFXimage::skipTo(uint32_t offset) {
+  uint32_t pos = _bytes - (_len - _pos);
+
+  if(pos > offset) return fail(GFX_IMAGE_FORMAT);
+  for(; pos < offset; pos++) {
+    if(read() < 0) return fail(GFX_IMAGE_TRUNCATED);
+  }
+  return true;
+}
+
+// One uncompressed row. The padding at the end of BMP rows decodes to
+// columns past the right edge, which ink() ignores.
+boolean GFXimage::readRow(int16_t row) {
+  uint16_t col = 0, lum = 0;
+  uint8_t  k = 0;
+  int16_t  c;
+
+  if(_mono < 0) memset(_row, 0, (_w + 7) / 8);
+  for(uint32_t i=0; i<_stride; i++) {
+    if((c = read()) < 0) return fail(GFX_IMAGE_TRUNCATED);
+    switch(_bpp) {
+     case 1:
+      if(_mono >= 0) {
+        if(i < (uint16_t)((_w + 7) / 8)) _row[i] = c ^ _mono;
+      } else {
+        for(uint8_t b=0x80; b; b >>= 1) ink(col++, row, _pal[(c & b) ? 1 : 0]);
+      }
+      break;
+     case 4:
+      ink(col++, row, _pal[c >> 4]);
+      ink(col++, row, _pal[c & 0x0F]);
+      break;
+     case 8:
+      ink(col++, row, _pal[c]);
+      break;
+     case 24:  // Blue, green, red
+      lum += (uint16_t)c * ((k == 0) ? 29 : (k == 1) ? 150 : 77);
+      if(++k == 3) {
+        ink(col++, row, lum >> 8);
+        lum = k = 0;
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+// One row of RLE8 or RLE4 data. A delta code can move down past rows, the
+// skipped rows and pixels are left as paper.
+boolean GFXimage::readRowRLE(int16_t row) {
+  uint16_t col = _rleCol;
+  int16_t  n, c;
+
+  memset(_row, 0, (_w + 7) / 8);
+  if(_rleSkip) {
+    _rleSkip--;
+    return true;
+  }
+  _rleCol = 0;
+  for(;;) {
+    if(((n = read()) < 0) || ((c = read()) < 0))
+      return fail(GFX_IMAGE_TRUNCATED);
+    if(n) {       // n pixels of color c, RLE4 alternates both nibbles
+      for(uint8_t k=0; k<n; k++) ink(col++, row, _pal[(_bpp == 8) ? c :
+        (k & 1) ? (c & 0x0F) : (c >> 4)]);
+    } else if(c == 0) {   // End of line
+      return true;
+    } else if(c == 1) {   // End of bitmap, the remaining rows are empty
+      _rleSkip = 0xFFFF;
+      return true;
+    } else if(c == 2) {   // Delta: move right and down
+      int16_t dx = read(), dy = read();
+      if((dx < 0) || (dy < 0)) return fail(GFX_IMAGE_TRUNCATED);
+      if(dy) {
+        _rleSkip = dy - 1;
+        _rleCol  = col + dx;
+        return true;
+      }
+      col += dx;
+    } else {      // c literal pixels, padded to an even number of bytes
+      uint8_t bytes = (_bpp == 8) ? c : (c + 1) / 2, k = 0;
+      for(uint8_t i=0; i<bytes; i++) {
+        if((n = read()) < 0) return fail(GFX_IMAGE_TRUNCATED);
+        if(_bpp == 8) {
+          ink(col++, row, _pal[n]);
+        } else {
+          ink(col++, row, _pal[n >> 4]);
+          if(++k < c) ink(col++, row, _pal[n & 0x0F]);
+          k++;
+        }
+      }
+      if((bytes & 1) && (read() < 0)) return fail(GFX_IMAGE_TRUNCATED);
+    }
+  }
+}
+
+// Set the ink bit when the gray level is darker than the dither threshold
+void GFXimage::ink(uint16_t col, int16_t row, uint8_t gray) {
+  if(col >= (uint16_t)_w) return;
+  if(bayer((_x + col) & 7, (_y + row) & 7) < (((255 - gray) * 65) >> 8))
+    _row[col >> 3] |= gfxBitMask(col & 7);
+}
+
+// Draw the row bits as runs, whole bytes continuing a run are skipped
+void GFXimage::drawRow(int16_t row) {
+  int16_t y = _y + row, start = 0;
+  boolean on = false, px;
+
+  if((y < 0) || (y >= _gfx->height())) return;
+  for(int16_t i=0; i<=_w; i++) {
+    if(!(i & 7) && (i + 8 <= _w) && (_row[i >> 3] == (on ? 0xFF : 0x00))) {
+      i += 7;
+      continue;
+    }
+    px = (i < _w) && (_row[i >> 3] & gfxBitMask(i & 7));
+    if((i == _w) || (px != on)) {
+      if((i > start) && (on || (_bg != _color)))
+        _gfx->writeFastHLine(_x + start, y, i - start, on ? _color : _bg);
+      start = i;
+      on    = px;
+    }
+  }
+}
+
+int16_t GFXimage::read(void) {
+  if(_pos >= _len) {
+    // Only ask for what is available, readBytes() would wait for a timeout
+    // at the end of a file on some cores.
+    int n = _stream->available();
+    if(n > GFX_IMAGE_CHUNK) n = GFX_IMAGE_CHUNK;
+    if(n < 1) n = 1;
+    _len = _stream->readBytes((char *)_buf, n);
+    _pos = 0;
+    if(!_len) return -1;
+    _bytes += _len;
+  }
+  return _buf[_pos++];
+}
+
+// Decimal number in a PNM header, after white space and # comments. The
+// one white space character after the number is read as well.
+int32_t GFXimage::readNumber(void) {
+  int32_t n = 0;
+  int16_t c;
+
+  for(;;) {
+    c = read();
+    if(c == '#') {
+      while(((c = read()) >= 0) && (c != '\n'));
+    } else if((c != ' ') && (c != '\t') && (c != '\r') && (c != '\n')) {
+      break;
+    }
+  }
+  if((c < '0') || (c > '9')) return -1;
+  while((c >= '0') && (c <= '9')) {
+    n = n * 10 + c - '0';
+    if(n > 0x7FFF) return -1;
+    c = read();
+  }
+  return n;
+}
@@ -0,0 +1,385 @@
+/*
+ * gfx_benchmark - Timing of Adafruit_GFX drawing primitives.
+ *
+ * This sketch draws into a 128x64 monochrome RAM buffer, so no display
+ * is required and the results only reflect the cost of the graphics code.
+ * Results are printed in microseconds on the serial port (115200 baud).
+ *
+ * Virtual vs. template front-end:
+ * The same pixel routine is bound to the regular Adafruit_GFX class (one
+ * virtual call per pixel) and to the Adafruit_GFX_T template (calls are
+ * resolved at compile time and can be inlined). To compare the code size
+ * on AVR, set one of BENCH_VIRTUAL or BENCH_TEMPLATE to 0 and look at the
+ * sketch size reported by the IDE.
+ *
+ * Lines:
+ * BENCH_LINES compares writeLine(), which writes runs of pixels as fast
+ * lines, with the previous per-pixel Bresenham code. It uses a driver that
+ * implements writeFastHLine/writeFastVLine on the page buffer, as display
+ * drivers with a RAM buffer usually do.
+ *
+ * Text cache:
+ * BENCH_TEXTCACHE draws a few labels with print() and from a GFXtextCache,
+ * which blits pre-rendered text as runs of pixels, on the same driver.
+ *
+ * Rotated bitmaps:
+ * BENCH_ROTATE draws a 32x32 bitmap with drawBitmap() and with
+ * drawBitmapRotated() at 0 and 30 degrees, and at twice the size.
+ *
+ * Row-aligned fonts:
+ * BENCH_FONTROWS prints the same text with FreeSerif9pt7b and with its
+ * row-aligned conversion FreeSerif9pt7br (fontconvert -r), on the per-pixel
+ * driver and on the driver with fast lines. See fontconvert/rowaligned.md
+ * for the flash cost of each bundled font.
+ *
+ * Numbers:
+ * BENCH_FIXED prints values with printFixed(). BENCH_FLOAT prints the same
+ * values with print(float, decimals). Build with only one of them set to
+ * see how much flash the float formatting code costs.
+ */
+#include <Adafruit_GFX.h>
+#include <Adafruit_GFX_T.h>
+#include <GFXtextcache.h>
+#include <Fonts/FreeSerif9pt7b.h>
+#include <Fonts/FreeSerif9pt7br.h>
+
+#define BENCH_VIRTUAL  1
+#define BENCH_TEMPLATE 1
+#define BENCH_LINES    1
+#define BENCH_TEXTCACHE 1
+#define BENCH_ROTATE   1
+#define BENCH_FONTROWS 1
+#define BENCH_FIXED    1
+#define BENCH_FLOAT    1
+
+#define BENCH_WIDTH  128
+#define BENCH_HEIGHT 64
+
+uint8_t buffer[BENCH_WIDTH * BENCH_HEIGHT / 8];
+
+// Pixel routine shared by both front-ends: page addressing like PCD8544/SSD1306
+inline void setBufferPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if((x < 0) || (y < 0) || (x >= BENCH_WIDTH) || (y >= BENCH_HEIGHT))
+    return;
+  if(color)
+    buffer[x + (y / 8) * BENCH_WIDTH] |= (1 << (y & 7));
+  else
+    buffer[x + (y / 8) * BENCH_WIDTH] &= ~(1 << (y & 7));
+}
+
+#if BENCH_VIRTUAL
+class VirtualLCD : public Adafruit_GFX {
+ public:
+  VirtualLCD(void) : Adafruit_GFX(BENCH_WIDTH, BENCH_HEIGHT) { }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { setBufferPixel(x, y, color); }
+  uint16_t getPixel(int16_t x, int16_t y) { return 0; }
+};
+VirtualLCD lcdVirtual;
+#endif
+
+#if BENCH_TEMPLATE
+class TemplateLCD : public Adafruit_GFX_T<TemplateLCD> {
+ public:
+  TemplateLCD(void) : Adafruit_GFX_T<TemplateLCD>(BENCH_WIDTH, BENCH_HEIGHT) { }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { setBufferPixel(x, y, color); }
+};
+TemplateLCD lcdTemplate;
+#endif
+
+#if BENCH_LINES || BENCH_TEXTCACHE || BENCH_FONTROWS
+class SpanLCD : public Adafruit_GFX {
+ public:
+  SpanLCD(void) : Adafruit_GFX(BENCH_WIDTH, BENCH_HEIGHT) { }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { setBufferPixel(x, y, color); }
+  uint16_t getPixel(int16_t x, int16_t y) { return 0; }
+
+  // Spans are only clipped, not checked per pixel
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+  {
+    if((y < 0) || (y >= BENCH_HEIGHT)) return;
+    if(x < 0) { w += x; x = 0; }
+    if(x + w > BENCH_WIDTH) w = BENCH_WIDTH - x;
+    uint8_t *p = &buffer[x + (y / 8) * BENCH_WIDTH], mask = 1 << (y & 7);
+    while(w-- > 0)
+    {
+      if(color) *p++ |= mask;
+      else      *p++ &= ~mask;
+    }
+  }
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+  {
+    if((x < 0) || (x >= BENCH_WIDTH)) return;
+    if(y < 0) { h += y; y = 0; }
+    if(y + h > BENCH_HEIGHT) h = BENCH_HEIGHT - y;
+    while(h > 0)
+    {
+      uint8_t n = 8 - (y & 7);
+      if(n > h) n = h;
+      uint8_t mask = (0xFF >> (8 - n)) << (y & 7);
+      if(color) buffer[x + (y / 8) * BENCH_WIDTH] |= mask;
+      else      buffer[x + (y / 8) * BENCH_WIDTH] &= ~mask;
+      y += n;
+      h -= n;
+    }
+  }
+};
+SpanLCD lcdSpan;
+#endif
+
+#if BENCH_LINES
+// The per-pixel Bresenham that writeLine() used before
+void pixelLine(Adafruit_GFX &gfx, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  int16_t t, steep = abs(y1 - y0) > abs(x1 - x0);
+  if(steep) { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+  if(x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+  int16_t dx = x1 - x0, dy = abs(y1 - y0), err = dx / 2, ystep = (y0 < y1) ? 1 : -1;
+  for(; x0 <= x1; x0++)
+  {
+    if(steep) gfx.writePixel(y0, x0, color);
+    else      gfx.writePixel(x0, y0, color);
+    err -= dy;
+    if(err < 0) { y0 += ystep; err += dx; }
+  }
+}
+
+void runLineBenchmark(void)
+{
+  uint32_t t;
+
+  Serial.print(F("Lines         "));
+  t = micros();
+  for(int16_t i = 0; i < BENCH_WIDTH; i += 2)
+  {
+    pixelLine(lcdSpan, 0, 0, BENCH_WIDTH - 1, i / 2, 1);   // mostly long runs
+    pixelLine(lcdSpan, i, 0, BENCH_WIDTH - 1 - i, BENCH_HEIGHT - 1, 1);
+    pixelLine(lcdSpan, -40, i / 3, BENCH_WIDTH + 40, BENCH_HEIGHT - i / 3, 1); // clipped
+  }
+  Serial.print(F(" per-pixel:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(int16_t i = 0; i < BENCH_WIDTH; i += 2)
+  {
+    lcdSpan.writeLine(0, 0, BENCH_WIDTH - 1, i / 2, 1);
+    lcdSpan.writeLine(i, 0, BENCH_WIDTH - 1 - i, BENCH_HEIGHT - 1, 1);
+    lcdSpan.writeLine(-40, i / 3, BENCH_WIDTH + 40, BENCH_HEIGHT - i / 3, 1);
+  }
+  Serial.print(F(" runs:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(int16_t i = 0; i < BENCH_WIDTH; i += 8)
+    lcdSpan.drawThickLine(0, i / 2, BENCH_WIDTH - 1, BENCH_HEIGHT - 1 - i / 2, 3, 1);
+  Serial.print(F(" thick(3):"));
+  Serial.println(micros() - t);
+}
+#endif
+
+#if BENCH_TEXTCACHE
+uint8_t labelArena[192];
+GFXtextCache labels(labelArena, sizeof(labelArena));
+
+void runTextCacheBenchmark(void)
+{
+  uint32_t t;
+
+  Serial.print(F("Labels        "));
+  t = micros();
+  for(uint8_t i = 0; i < 8; i++)
+  {
+    lcdSpan.setFont(&FreeSerif9pt7b);
+    lcdSpan.setTextColor(1);
+    lcdSpan.setCursor(0, 14);
+    lcdSpan.print(F("Clock"));
+    lcdSpan.setCursor(90, 40);
+    lcdSpan.print(F("'C"));
+  }
+  Serial.print(F(" print:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(uint8_t i = 0; i < 8; i++)
+  {
+    labels.draw(&lcdSpan, 0, 14, F("Clock"), &FreeSerif9pt7b, 1, 1, 1);
+    labels.draw(&lcdSpan, 90, 40, F("'C"), &FreeSerif9pt7b, 1, 1, 1);
+  }
+  Serial.print(F(" cached:"));
+  Serial.println(micros() - t);
+  lcdSpan.setFont();
+}
+#endif
+
+#if BENCH_FONTROWS && BENCH_VIRTUAL
+void printFont(Adafruit_GFX &gfx, const GFXfont *f)
+{
+  uint32_t t = micros();
+  gfx.setFont(f);
+  gfx.setTextColor(1);
+  for(uint8_t i = 0; i < 4; i++)
+  {
+    gfx.setCursor(0, 14 + i * 16);
+    gfx.print(F("Temp 21.5'C"));
+  }
+  gfx.setFont();
+  Serial.print(micros() - t);
+}
+
+void runFontRowsBenchmark(void)
+{
+  Serial.print(F("Font rows     "));
+  Serial.print(F(" packed:"));
+  printFont(lcdVirtual, &FreeSerif9pt7b);
+  Serial.print(F(" aligned:"));
+  printFont(lcdVirtual, &FreeSerif9pt7br);
+  Serial.print(F(" spans packed:"));
+  printFont(lcdSpan, &FreeSerif9pt7b);
+  Serial.print(F(" aligned:"));
+  printFont(lcdSpan, &FreeSerif9pt7br);
+  Serial.println();
+}
+#endif
+
+#if BENCH_ROTATE && BENCH_VIRTUAL
+// 32x32 compass rose: a ring with an arrow
+const uint8_t PROGMEM compass[32 * 4] = {
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x01, 0x81, 0x81, 0x80, 0x02, 0x01, 0x80, 0x40,
+  0x04, 0x03, 0xC0, 0x20, 0x08, 0x03, 0xC0, 0x10, 0x10, 0x07, 0xE0, 0x08, 0x20, 0x07, 0xE0, 0x04,
+  0x20, 0x0F, 0xF0, 0x04, 0x40, 0x0F, 0xF0, 0x02, 0x40, 0x01, 0x80, 0x02, 0x40, 0x01, 0x80, 0x02,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF0, 0x01, 0x80, 0x0F,
+  0xF0, 0x01, 0x80, 0x0F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x40, 0x01, 0x80, 0x02, 0x40, 0x01, 0x80, 0x02, 0x40, 0x01, 0x80, 0x02, 0x20, 0x01, 0x80, 0x04,
+  0x20, 0x01, 0x80, 0x04, 0x10, 0x01, 0x80, 0x08, 0x08, 0x01, 0x80, 0x10, 0x04, 0x01, 0x80, 0x20,
+  0x02, 0x01, 0x80, 0x40, 0x01, 0x81, 0x81, 0x80, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x0F, 0xF0, 0x00
+};
+
+void runRotateBenchmark(void)
+{
+  uint32_t t;
+
+  Serial.print(F("Bitmap 32x32  "));
+  t = micros();
+  for(uint8_t i = 0; i < 4; i++)
+    lcdVirtual.drawBitmap(48, 16, compass, 32, 32, 1, 0);
+  Serial.print(F(" drawBitmap:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(uint8_t i = 0; i < 4; i++)
+    lcdVirtual.drawBitmapRotated(64, 32, compass, 32, 32, 16, 16, 0, 256, 1, 0);
+  Serial.print(F(" rotated 0:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(uint8_t i = 0; i < 4; i++)
+    lcdVirtual.drawBitmapRotated(64, 32, compass, 32, 32, 16, 16, 30, 256, 1, 0);
+  Serial.print(F(" rotated 30:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(uint8_t i = 0; i < 4; i++)
+    lcdVirtual.drawBitmapRotated(64, 32, compass, 32, 32, 16, 16, 30, 512, 1, 1);
+  Serial.print(F(" x2:"));
+  Serial.println(micros() - t);
+}
+#endif
+
+#if BENCH_FIXED || BENCH_FLOAT
+void runNumberBenchmark(Adafruit_GFX &gfx)
+{
+  uint32_t t;
+
+  Serial.print(F("Numbers       "));
+  gfx.setTextColor(1, 0);
+#if BENCH_FIXED
+  t = micros();
+  gfx.setCursor(0, 0);
+  for(int16_t i = -500; i < 500; i += 7)
+    gfx.printFixed(i * 13L, 2);       // -65.00 .. 64.87
+  Serial.print(F(" printFixed:"));
+  Serial.print(micros() - t);
+#endif
+#if BENCH_FLOAT
+  t = micros();
+  gfx.setCursor(0, 0);
+  for(int16_t i = -500; i < 500; i += 7)
+    gfx.print(i * 0.13f, 2);
+  Serial.print(F(" print(float):"));
+  Serial.print(micros() - t);
+#endif
+  Serial.println();
+}
+#endif
+
+// Run the same drawing code on any front-end and print the timings
+template <class GFX> void runBenchmark(GFX &gfx, const __FlashStringHelper *szName)
+{
+  uint32_t t;
+
+  Serial.print(szName);
+
+  t = micros();
+  for(int16_t i = 0; i < BENCH_WIDTH; i += 4)
+  {
+    gfx.drawLine(0, 0, i, BENCH_HEIGHT - 1, 1);
+    gfx.drawLine(0, BENCH_HEIGHT - 1, BENCH_WIDTH - 1, i / 2, 1);
+  }
+  Serial.print(F(" lines:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(int16_t i = 0; i < 16; i++)
+    gfx.fillRect(i * 4, i * 2, 40, 24, i & 1);
+  Serial.print(F(" rects:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  for(int16_t r = 2; r < BENCH_HEIGHT / 2; r += 3)
+  {
+    gfx.drawCircle(BENCH_WIDTH / 2, BENCH_HEIGHT / 2, r, 1);
+    gfx.fillCircle(r * 3, BENCH_HEIGHT / 2, r / 3, 0);
+  }
+  Serial.print(F(" circles:"));
+  Serial.print(micros() - t);
+
+  t = micros();
+  gfx.setCursor(0, 0);
+  gfx.setTextColor(1, 0);
+  for(uint8_t i = 0; i < 8; i++)
+    gfx.print(F("0123456789:-ABC"));
+  Serial.print(F(" text:"));
+  Serial.println(micros() - t);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(F("gfx_benchmark (time in us)"));
+}
+
+void loop()
+{
+#if BENCH_VIRTUAL
+  runBenchmark(lcdVirtual, F("Adafruit_GFX  "));
+#endif
+#if BENCH_TEMPLATE
+  runBenchmark(lcdTemplate, F("Adafruit_GFX_T"));
+#endif
+#if BENCH_LINES
+  runLineBenchmark();
+#endif
+#if BENCH_TEXTCACHE
+  runTextCacheBenchmark();
+#endif
+#if BENCH_FONTROWS && BENCH_VIRTUAL
+  runFontRowsBenchmark();
+#endif
+#if BENCH_ROTATE && BENCH_VIRTUAL
+  runRotateBenchmark();
+#endif
+#if BENCH_VIRTUAL && (BENCH_FIXED || BENCH_FLOAT)
+  runNumberBenchmark(lcdVirtual);
+#endif
+  delay(2000);
+}
@@ -5,8 +5,9 @@
 # 'Sans' (Helvetica-like) and 'Serif' (Times-like); four styles: regular,
 # bold, oblique or italic, and bold+oblique or bold+italic; and four
 # sizes: 9, 12, 18 and 24 point.  No real error checking or anything,
-# this just powers through all the combinations, calling the fontconvert
-# utility and redirecting the output to a .h file for each combo.
+# this just lists all the combinations in a manifest for the batch mode
+# of the fontconvert utility, which loads each font once, converts its
+# sizes on all CPU cores and writes a .h file for each combo.
 
 # Adafruit_GFX repository does not include the source outline fonts
 # (huge zipfile, different license) but they're easily acquired:
@@ -19,20 +20,19 @@ fonts=(FreeMono FreeSans FreeSerif)
 styles=("" Bold Italic BoldItalic Oblique BoldOblique)
 sizes=(9 12 18 24)
 
+manifest=$(mktemp)
 for f in ${fonts[*]}
 do
 	for index in ${!styles[*]}
 	do
 		st=${styles[$index]}
-		for si in ${sizes[*]}
-		do
-			infile=$inpath$f$st".ttf"
-			if [ -f $infile ] # Does source combination exist?
-			  then
-				outfile=$outpath$f$st$si"pt7b.h"
-#				printf "%s %s %s > %s\n" $convert $infile $si $outfile
-				$convert $infile $si > $outfile
-			fi
-		done
+		infile=$inpath$f$st".ttf"
+		if [ -f $infile ] # Does source combination exist?
+		  then
+			# One line per font, outputs are $f$st$si"pt7b.h"
+			echo $infile ${sizes[*]} >> $manifest
+		fi
 	done
 done
+$convert -b $manifest -o $outpath
+rm -f $manifest
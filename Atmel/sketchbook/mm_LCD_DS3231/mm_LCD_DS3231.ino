@@ -68,11 +68,16 @@ RtcDS3231<TwoWire> Rtc(Wire);
 // include the fonts we will use to display text
 #include <Fonts/FreeSansOblique12pt7b.h>
 #include <Fonts/FreeSerif9pt7b.h>
+#include <GFXtextcache.h>
 
 // declare the objects used for the LCD
 mxUnified74HC595 unio = mxUnified74HC595();                  // use hardware SPI pins, no cascading (requires additional pins for DC and CLK
 mxUnifiedLcdEdentifier2 display = mxUnifiedLcdEdentifier2(&unio, 8, 9);         // e.dentifier2 LCD: datapins P0-P7, DC=D8, CLK=D9 (DC and CLK are MCU pins)
 
+// static labels are rendered once and then copied from this cache
+uint8_t labelArena[64];
+GFXtextCache labels(labelArena, sizeof(labelArena));
+
 
 void setup () 
 {
@@ -188,14 +193,19 @@ void loop ()
   display.print(szTime);
 
   // print the temperature
+  // in hundredths of a degree, same value as AsFloat() but without float code
   RtcTemperature temp = Rtc.GetTemperature();
+  int16_t nTemp = temp.AsWholeDegrees() * 100;
+  nTemp += (nTemp < 0) ? -temp.GetFractional() : temp.GetFractional();
   Serial.print("   -   ");
-  Serial.print(temp.AsFloat());
+  Serial.print(nTemp / 100);
+  Serial.print('.');
+  Serial.print(abs(nTemp % 100));
   Serial.println("C");
   display.setFont(&FreeSerif9pt7b);
   display.setCursor(0,14);    // different origin-system on fonts in rotated display
-  display.print(temp.AsFloat(),1);
-  display.print("'C");
+  display.printFixed((nTemp + ((nTemp < 0) ? -5 : 5)) / 10, 1);  // rounded like print(float,1)
+  labels.draw(&display, display.getCursorX(), display.getCursorY(), "'C", &FreeSerif9pt7b, 1, BLACK, BLACK);
 
   // show a blinking dot on the display behind the C
   fBlink=!fBlink;
@@ -206,4 +216,4 @@ void loop ()
   display.display();
   delay(250);
 }
-
+
@@ -0,0 +1,236 @@
+const uint8_t FreeSerif9pt7brBitmaps[] PROGMEM = {
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0,
+  0xD8, 0xD8, 0xD8, 0x90, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00,
+  0xFF, 0x80, 0x22, 0x00, 0x22, 0x00, 0xFF, 0x80, 0x24, 0x00, 0x24, 0x00,
+  0x24, 0x00, 0x64, 0x00, 0x10, 0x7C, 0xD6, 0xD2, 0xD0, 0xF0, 0x38, 0x1E,
+  0x17, 0x93, 0x93, 0xD6, 0x7C, 0x10, 0x38, 0x40, 0x67, 0x80, 0xE4, 0x80,
+  0xC5, 0x00, 0xC5, 0x00, 0xCA, 0x70, 0x72, 0xC8, 0x05, 0xC8, 0x05, 0x88,
+  0x09, 0x88, 0x11, 0x90, 0x10, 0xE0, 0x0E, 0x00, 0x19, 0x00, 0x19, 0x00,
+  0x19, 0x00, 0x1A, 0x00, 0x0E, 0xF0, 0x0C, 0x60, 0x3C, 0x40, 0x46, 0x80,
+  0xC6, 0x80, 0xC3, 0x00, 0xE3, 0x88, 0x7C, 0xF0, 0xC0, 0xC0, 0xC0, 0x80,
+  0x08, 0x10, 0x20, 0x40, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x40,
+  0x20, 0x10, 0x08, 0x80, 0x40, 0x20, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x10, 0x10, 0x20, 0x40, 0x80, 0x60, 0xE4, 0xAC, 0x70, 0x70, 0xAC,
+  0x60, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xFF, 0x80,
+  0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xC0, 0x40, 0x80, 0xF0,
+  0xC0, 0xC0, 0x08, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x60, 0x40, 0x40,
+  0xC0, 0x80, 0x1C, 0x00, 0x63, 0x00, 0x63, 0x00, 0xC1, 0x80, 0xC1, 0x80,
+  0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0x63, 0x00,
+  0x23, 0x00, 0x1C, 0x00, 0x10, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x78, 0x3C, 0x4E, 0x86, 0x06, 0x06, 0x04, 0x0C,
+  0x08, 0x10, 0x20, 0x41, 0xFE, 0x3C, 0xC6, 0x06, 0x04, 0x1C, 0x3E, 0x07,
+  0x03, 0x03, 0x03, 0x06, 0xF8, 0x04, 0x0C, 0x1C, 0x2C, 0x4C, 0x4C, 0x8C,
+  0x8C, 0xFE, 0x0C, 0x0C, 0x0C, 0x0F, 0x10, 0x20, 0x3C, 0x0E, 0x07, 0x03,
+  0x03, 0x03, 0x02, 0x04, 0xF8, 0x07, 0x1C, 0x30, 0x60, 0x60, 0xDC, 0xE6,
+  0xC3, 0xC3, 0xC3, 0x43, 0x66, 0x3C, 0x7F, 0x82, 0x02, 0x02, 0x04, 0x04,
+  0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x3C, 0x46, 0xC6, 0xC6, 0xE4, 0x78,
+  0x18, 0x6C, 0xC6, 0xC6, 0xC6, 0x66, 0x3C, 0x3C, 0x66, 0xC2, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x63, 0x3F, 0x06, 0x06, 0x0C, 0x38, 0x60, 0xC0, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x20, 0x40, 0x01, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x80, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x70, 0x00, 0x1C,
+  0x00, 0x07, 0x00, 0x01, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xC0,
+  0x00, 0x78, 0x8C, 0x86, 0x06, 0x06, 0x04, 0x0C, 0x08, 0x10, 0x10, 0x10,
+  0x00, 0x30, 0x0F, 0x80, 0x38, 0xC0, 0x60, 0x20, 0x60, 0x20, 0xC7, 0x90,
+  0xCC, 0x90, 0xD8, 0x90, 0xD9, 0x90, 0xD9, 0x20, 0x6E, 0xC0, 0x60, 0x00,
+  0x30, 0x40, 0x0F, 0x80, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0B, 0x00,
+  0x09, 0x80, 0x09, 0x80, 0x10, 0xC0, 0x1F, 0xC0, 0x20, 0x60, 0x20, 0x60,
+  0x60, 0x70, 0xF0, 0xF8, 0xFF, 0x80, 0x30, 0xE0, 0x30, 0x60, 0x30, 0x60,
+  0x30, 0xC0, 0x3F, 0x00, 0x30, 0xC0, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
+  0x30, 0xC0, 0xFF, 0x80, 0x1F, 0x20, 0x30, 0xE0, 0x60, 0x60, 0xC0, 0x20,
+  0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00,
+  0x30, 0x60, 0x1F, 0x80, 0xFF, 0x00, 0x31, 0xC0, 0x30, 0x60, 0x30, 0x70,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60,
+  0x30, 0xC0, 0xFF, 0x00, 0xFF, 0x80, 0x60, 0x80, 0x60, 0x00, 0x60, 0x00,
+  0x61, 0x00, 0x7F, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x40,
+  0x60, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0x60, 0x80, 0x60, 0x00, 0x60, 0x00,
+  0x61, 0x00, 0x7F, 0x00, 0x61, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0xF0, 0x00, 0x1F, 0x20, 0x30, 0xE0, 0x60, 0x20, 0x60, 0x00,
+  0xC0, 0x00, 0xC0, 0xF0, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0x60, 0x60,
+  0x30, 0x60, 0x0F, 0x80, 0xF1, 0xE0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0,
+  0x60, 0xC0, 0x7F, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0,
+  0x60, 0xC0, 0xF1, 0xE0, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0xF0, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0xD8, 0xF0, 0xF3, 0xE0, 0x60, 0x80, 0x61, 0x00, 0x62, 0x00,
+  0x64, 0x00, 0x78, 0x00, 0x6C, 0x00, 0x66, 0x00, 0x63, 0x00, 0x61, 0x80,
+  0x60, 0xC0, 0xF3, 0xF0, 0xF0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x40,
+  0x60, 0x80, 0xFF, 0x80, 0xF0, 0x0E, 0x38, 0x1C, 0x38, 0x1C, 0x3C, 0x2C,
+  0x2C, 0x2C, 0x2E, 0x4C, 0x26, 0x4C, 0x26, 0x4C, 0x23, 0x8C, 0x23, 0x8C,
+  0x21, 0x0C, 0x71, 0x1E, 0xE0, 0xE0, 0x70, 0x40, 0x70, 0x40, 0x58, 0x40,
+  0x5C, 0x40, 0x4E, 0x40, 0x46, 0x40, 0x43, 0x40, 0x41, 0xC0, 0x40, 0xC0,
+  0x40, 0xC0, 0xE0, 0x40, 0x1F, 0x00, 0x31, 0x80, 0x60, 0xC0, 0x40, 0x40,
+  0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0x40, 0x40,
+  0x60, 0xC0, 0x31, 0x80, 0x1F, 0x00, 0xFE, 0x00, 0x63, 0x00, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0x63, 0x00, 0x7E, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x31, 0x80, 0x60, 0xC0,
+  0x40, 0x40, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60,
+  0x40, 0xC0, 0x60, 0xC0, 0x31, 0x80, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x00, 0xE0, 0xFE, 0x00, 0x63, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+  0x63, 0x00, 0x7E, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x63, 0x80, 0x61, 0xC0,
+  0xF0, 0xE0, 0x1D, 0x00, 0x63, 0x00, 0x61, 0x00, 0x60, 0x00, 0x78, 0x00,
+  0x1C, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80, 0x41, 0x80, 0x63, 0x00,
+  0x5E, 0x00, 0xFF, 0xE0, 0xC6, 0x60, 0x86, 0x20, 0x06, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x0F, 0x00, 0xF0, 0xE0, 0x60, 0x40, 0x60, 0x40, 0x60, 0x40, 0x60, 0x40,
+  0x60, 0x40, 0x60, 0x40, 0x60, 0x40, 0x60, 0x40, 0x60, 0x40, 0x30, 0x80,
+  0x1F, 0x00, 0xF8, 0x70, 0x70, 0x20, 0x30, 0x20, 0x30, 0x40, 0x18, 0x40,
+  0x18, 0x40, 0x0C, 0x80, 0x0C, 0x80, 0x07, 0x00, 0x07, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0xFB, 0xE7, 0x80, 0x61, 0x81, 0x00, 0x30, 0x82, 0x00, 0x30,
+  0xC2, 0x00, 0x18, 0xC4, 0x00, 0x19, 0x64, 0x00, 0x19, 0x64, 0x00, 0x0D,
+  0x38, 0x00, 0x0E, 0x38, 0x00, 0x06, 0x38, 0x00, 0x04, 0x10, 0x00, 0x04,
+  0x10, 0x00, 0xFC, 0xF8, 0x30, 0x60, 0x18, 0x40, 0x0C, 0x80, 0x0D, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x09, 0x80, 0x11, 0xC0, 0x30, 0xC0, 0x20, 0x60,
+  0xF1, 0xF8, 0xF8, 0xF0, 0x60, 0x60, 0x30, 0x40, 0x18, 0x80, 0x1D, 0x00,
+  0x0D, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x0F, 0x00, 0x3F, 0xC0, 0x60, 0x80, 0x41, 0x80, 0x03, 0x00, 0x07, 0x00,
+  0x06, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30, 0x20, 0x70, 0x40,
+  0xFF, 0xC0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0x80, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20,
+  0x30, 0x10, 0x10, 0x18, 0x08, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0x18, 0x1C, 0x34, 0x26,
+  0x62, 0x42, 0xC1, 0xFF, 0x80, 0x80, 0x40, 0x20, 0x78, 0xCC, 0x0C, 0x1C,
+  0x6C, 0xCC, 0xCC, 0x7E, 0x20, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x63, 0x00, 0x3E, 0x00, 0x3C, 0x66, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x62, 0x3C, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x3B, 0x00, 0x67, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00,
+  0x63, 0x00, 0x3F, 0x00, 0x3C, 0x46, 0xFE, 0xC0, 0xC0, 0xE1, 0x62, 0x3C,
+  0x1E, 0x20, 0x60, 0x60, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0xF0, 0x3C, 0x00, 0x67, 0xC0, 0x63, 0x00, 0x63, 0x00, 0x1E, 0x00, 0x20,
+  0x00, 0x40, 0x00, 0x7F, 0x00, 0x40, 0x80, 0xC0, 0x80, 0xE1, 0x00, 0x7E,
+  0x00, 0x20, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6E,
+  0x00, 0x73, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63,
+  0x00, 0xF7, 0x80, 0x60, 0x00, 0x00, 0x20, 0xE0, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0xF0, 0x18, 0x00, 0x00, 0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x10, 0xE0, 0x20, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x60,
+  0x00, 0x60, 0x00, 0x67, 0x80, 0x62, 0x00, 0x6C, 0x00, 0x78, 0x00, 0x6C,
+  0x00, 0x66, 0x00, 0x63, 0x00, 0xF7, 0x80, 0x20, 0xE0, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF0, 0xEE, 0x70, 0x73, 0x98,
+  0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0x63, 0x18, 0xF7, 0xBC,
+  0xEE, 0x00, 0x73, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0xF7, 0x80, 0x3E, 0x00, 0x63, 0x00, 0xC1, 0x80, 0xC1, 0x80,
+  0xC1, 0x80, 0xC1, 0x80, 0x63, 0x00, 0x3E, 0x00, 0xEE, 0x00, 0x73, 0x00,
+  0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x63, 0x00, 0x7E, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x63, 0x00,
+  0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xE3, 0x00, 0x7F, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x80, 0x6C, 0x70, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0xF0, 0x74, 0x8C, 0x84, 0x60, 0x3C, 0x8C, 0x8C, 0xF8,
+  0x20, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x38, 0xE7, 0x00, 0x63,
+  0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x3F,
+  0x80, 0xF3, 0x61, 0x22, 0x32, 0x14, 0x1C, 0x08, 0x08, 0xEF, 0x30, 0x66,
+  0x10, 0x62, 0x20, 0x23, 0x20, 0x35, 0x40, 0x19, 0xC0, 0x18, 0x80, 0x10,
+  0x80, 0xF7, 0x00, 0x24, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x24,
+  0x00, 0x42, 0x00, 0xE7, 0x80, 0xF3, 0x61, 0x62, 0x32, 0x34, 0x14, 0x1C,
+  0x08, 0x08, 0x08, 0x10, 0xE0, 0xFC, 0x8C, 0x18, 0x10, 0x30, 0x62, 0xC2,
+  0xFC, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x60, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x18, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x20, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x70, 0x00, 0x49,
+  0x80, 0x07, 0x00 };
+
+const GFXglyph FreeSerif9pt7brGlyphs[] PROGMEM = {
+  {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
+  {     0,   2,  12,   6,    2,  -11 },   // 0x21 '!'
+  {    12,   5,   4,   7,    1,  -11 },   // 0x22 '"'
+  {    16,   9,  12,   9,    0,  -11 },   // 0x23 '#'
+  {    40,   8,  14,   9,    1,  -12 },   // 0x24 '$'
+  {    54,  13,  12,  15,    1,  -11 },   // 0x25 '%'
+  {    78,  13,  13,  14,    1,  -12 },   // 0x26 '&'
+  {   104,   2,   4,   4,    1,  -11 },   // 0x27 '''
+  {   108,   5,  15,   6,    1,  -11 },   // 0x28 '('
+  {   123,   5,  15,   6,    0,  -11 },   // 0x29 ')'
+  {   138,   6,   8,   9,    3,  -11 },   // 0x2A '*'
+  {   146,   9,   9,  10,    0,   -8 },   // 0x2B '+'
+  {   164,   2,   3,   4,    2,    0 },   // 0x2C ','
+  {   167,   4,   1,   6,    1,   -3 },   // 0x2D '-'
+  {   168,   2,   2,   5,    1,   -1 },   // 0x2E '.'
+  {   170,   5,  12,   5,    0,  -11 },   // 0x2F '/'
+  {   182,   9,  13,   9,    0,  -12 },   // 0x30 '0'
+  {   208,   5,  13,   9,    2,  -12 },   // 0x31 '1'
+  {   221,   8,  12,   9,    1,  -11 },   // 0x32 '2'
+  {   233,   8,  12,   9,    0,  -11 },   // 0x33 '3'
+  {   245,   7,  12,   9,    1,  -11 },   // 0x34 '4'
+  {   257,   8,  12,   9,    0,  -11 },   // 0x35 '5'
+  {   269,   8,  13,   9,    1,  -12 },   // 0x36 '6'
+  {   282,   8,  12,   9,    0,  -11 },   // 0x37 '7'
+  {   294,   7,  13,   9,    1,  -12 },   // 0x38 '8'
+  {   307,   8,  14,   9,    1,  -12 },   // 0x39 '9'
+  {   321,   2,   8,   5,    1,   -7 },   // 0x3A ':'
+  {   329,   3,  10,   5,    1,   -7 },   // 0x3B ';'
+  {   339,   9,   9,  10,    1,   -8 },   // 0x3C '<'
+  {   357,   9,   5,  10,    1,   -6 },   // 0x3D '='
+  {   367,  10,   9,  10,    0,   -8 },   // 0x3E '>'
+  {   385,   7,  13,   8,    1,  -12 },   // 0x3F '?'
+  {   398,  12,  13,  16,    2,  -12 },   // 0x40 '@'
+  {   424,  13,  12,  13,    0,  -11 },   // 0x41 'A'
+  {   448,  11,  12,  11,    0,  -11 },   // 0x42 'B'
+  {   472,  11,  12,  12,    1,  -11 },   // 0x43 'C'
+  {   496,  12,  12,  13,    0,  -11 },   // 0x44 'D'
+  {   520,  10,  12,  11,    1,  -11 },   // 0x45 'E'
+  {   544,   9,  12,  10,    1,  -11 },   // 0x46 'F'
+  {   568,  12,  12,  13,    1,  -11 },   // 0x47 'G'
+  {   592,  11,  12,  13,    1,  -11 },   // 0x48 'H'
+  {   616,   4,  12,   6,    1,  -11 },   // 0x49 'I'
+  {   628,   6,  12,   7,    0,  -11 },   // 0x4A 'J'
+  {   640,  12,  12,  13,    1,  -11 },   // 0x4B 'K'
+  {   664,  10,  12,  11,    1,  -11 },   // 0x4C 'L'
+  {   688,  15,  12,  16,    0,  -11 },   // 0x4D 'M'
+  {   712,  11,  12,  13,    1,  -11 },   // 0x4E 'N'
+  {   736,  11,  13,  13,    1,  -12 },   // 0x4F 'O'
+  {   762,   9,  12,  10,    1,  -11 },   // 0x50 'P'
+  {   786,  11,  16,  13,    1,  -12 },   // 0x51 'Q'
+  {   818,  11,  12,  12,    1,  -11 },   // 0x52 'R'
+  {   842,   9,  12,  10,    0,  -11 },   // 0x53 'S'
+  {   866,  11,  12,  11,    0,  -11 },   // 0x54 'T'
+  {   890,  11,  12,  13,    1,  -11 },   // 0x55 'U'
+  {   914,  12,  12,  13,    0,  -11 },   // 0x56 'V'
+  {   938,  17,  12,  17,    0,  -11 },   // 0x57 'W'
+  {   974,  13,  12,  13,    0,  -11 },   // 0x58 'X'
+  {   998,  12,  12,  13,    0,  -11 },   // 0x59 'Y'
+  {  1022,  11,  12,  11,    0,  -11 },   // 0x5A 'Z'
+  {  1046,   3,  15,   6,    2,  -11 },   // 0x5B '['
+  {  1061,   5,  12,   5,    0,  -11 },   // 0x5C '\'
+  {  1073,   3,  15,   6,    1,  -11 },   // 0x5D ']'
+  {  1088,   8,   7,   8,    0,  -11 },   // 0x5E '^'
+  {  1095,   9,   1,   9,    0,    2 },   // 0x5F '_'
+  {  1097,   4,   3,   5,    0,  -11 },   // 0x60 '`'
+  {  1100,   7,   8,   8,    1,   -7 },   // 0x61 'a'
+  {  1108,   9,  13,   9,    0,  -12 },   // 0x62 'b'
+  {  1134,   7,   8,   8,    0,   -7 },   // 0x63 'c'
+  {  1142,   9,  13,   9,    0,  -12 },   // 0x64 'd'
+  {  1168,   8,   8,   8,    0,   -7 },   // 0x65 'e'
+  {  1176,   7,  13,   7,    1,  -12 },   // 0x66 'f'
+  {  1189,  10,  12,   8,    0,   -7 },   // 0x67 'g'
+  {  1213,   9,  13,   9,    0,  -12 },   // 0x68 'h'
+  {  1239,   4,  11,   5,    1,  -10 },   // 0x69 'i'
+  {  1250,   5,  15,   6,    0,  -10 },   // 0x6A 'j'
+  {  1265,   9,  13,   9,    1,  -12 },   // 0x6B 'k'
+  {  1291,   4,  13,   5,    1,  -12 },   // 0x6C 'l'
+  {  1304,  14,   8,  14,    0,   -7 },   // 0x6D 'm'
+  {  1320,   9,   8,   9,    0,   -7 },   // 0x6E 'n'
+  {  1336,   9,   8,   9,    0,   -7 },   // 0x6F 'o'
+  {  1352,   9,  12,   9,    0,   -7 },   // 0x70 'p'
+  {  1376,   9,  12,   9,    0,   -7 },   // 0x71 'q'
+  {  1400,   6,   8,   6,    0,   -7 },   // 0x72 'r'
+  {  1408,   6,   8,   7,    1,   -7 },   // 0x73 's'
+  {  1416,   5,   9,   5,    0,   -8 },   // 0x74 't'
+  {  1425,   9,   8,   9,    0,   -7 },   // 0x75 'u'
+  {  1441,   8,   8,   8,    0,   -7 },   // 0x76 'v'
+  {  1449,  12,   8,  12,    0,   -7 },   // 0x77 'w'
+  {  1465,   9,   8,   9,    0,   -7 },   // 0x78 'x'
+  {  1481,   8,  12,   8,    0,   -7 },   // 0x79 'y'
+  {  1493,   7,   8,   7,    1,   -7 },   // 0x7A 'z'
+  {  1501,   5,  16,   9,    1,  -12 },   // 0x7B '{'
+  {  1517,   1,  12,   4,    1,  -11 },   // 0x7C '|'
+  {  1529,   5,  16,   9,    3,  -11 },   // 0x7D '}'
+  {  1545,   9,   3,   9,    0,   -5 } }; // 0x7E '~'
+
+const GFXfont FreeSerif9pt7br PROGMEM = {
+  (uint8_t  *)FreeSerif9pt7brBitmaps,
+  (GFXglyph *)FreeSerif9pt7brGlyphs,
+  0x20, 0x7E, 22, GFX_FONT_ROWALIGNED };
+
+// Approx. 2224 bytes
+// Row alignment adds 471 bytes to 1080 bit-packed
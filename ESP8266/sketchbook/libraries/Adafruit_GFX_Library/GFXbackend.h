@@ -0,0 +1,34 @@
+#ifndef _GFXBACKEND_H
+#define _GFXBACKEND_H
+
+// Platform backend of Adafruit_GFX.  The core is the same for all boards,
+// the backend holds what differs per target: how PROGMEM data is read and
+// which bit and word operations are cheap.  Each backend provides
+//   pgm_read_byte/word/dword/pointer  PROGMEM access (fonts, bitmaps)
+//   GFXflashReader                    sequential PROGMEM byte reader
+//   gfxBitMask(bit)                   0x80 >> bit, for bit 0 to 7
+//   GFX_FLOODFILL_STACK               default span stack of floodFill()
+// The backend is selected from the board.  Define GFX_BACKEND_AVR,
+// GFX_BACKEND_ESP8266 or GFX_BACKEND_GENERIC in the build flags to force
+// one, eg. the generic backend for a host build.
+
+#if !defined(GFX_BACKEND_AVR) && !defined(GFX_BACKEND_ESP8266) && \
+    !defined(GFX_BACKEND_GENERIC)
+ #if defined(__AVR__)
+  #define GFX_BACKEND_AVR
+ #elif defined(ESP8266)
+  #define GFX_BACKEND_ESP8266
+ #else
+  #define GFX_BACKEND_GENERIC
+ #endif
+#endif
+
+#if defined(GFX_BACKEND_AVR)
+ #include "GFXbackend_avr.h"
+#elif defined(GFX_BACKEND_ESP8266)
+ #include "GFXbackend_esp8266.h"
+#else
+ #include "GFXbackend_generic.h"
+#endif
+
+#endif // _GFXBACKEND_H
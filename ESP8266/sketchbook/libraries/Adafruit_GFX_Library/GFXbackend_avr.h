@@ -0,0 +1,37 @@
+#ifndef _GFXBACKEND_AVR_H
+#define _GFXBACKEND_AVR_H
+
+// AVR backend: 8-bit core with 16-bit pointers.  PROGMEM is read with lpm,
+// and a shift by a variable count is a loop, so bit masks come from a
+// table.  RAM is scarce, so the floodFill() stack is small (7 bytes per
+// span).
+
+#include <avr/pgmspace.h>
+
+#ifndef pgm_read_pointer
+ #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#endif
+
+// GFX_FLOODFILL_STACK: pending spans in floodFill(), kept on the stack
+// (7 bytes each).  Busy areas with text need about 64 to be filled
+// completely, but that does not fit next to a sketch on small AVRs.
+#ifndef GFX_FLOODFILL_STACK
+ #define GFX_FLOODFILL_STACK 32
+#endif
+
+class GFXflashReader {
+ public:
+  GFXflashReader(const uint8_t *addr) { seek(addr); }
+  inline void    seek(const uint8_t *addr) { _addr = addr; }
+  inline uint8_t read(void) { return pgm_read_byte(_addr++); }
+ private:
+  const uint8_t *_addr;
+};
+
+static inline uint8_t gfxBitMask(uint8_t bit) {
+  static const uint8_t PROGMEM
+    GFXsetBit[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+  return pgm_read_byte(&GFXsetBit[bit]);
+}
+
+#endif // _GFXBACKEND_AVR_H
@@ -0,0 +1,52 @@
+#ifndef _GFXBACKEND_ESP8266_H
+#define _GFXBACKEND_ESP8266_H
+
+// ESP8266 backend: 32-bit core with a barrel shifter, so bit masks are
+// plain shifts.  Flash can only be read as aligned 32-bit words, so each
+// pgm_read_byte() is a word load plus a shift.  GFXflashReader loads every
+// word once and hands out its bytes from a register, one flash access per
+// four bytes.  The last word may extend past the end of the data, which is
+// harmless since any aligned word holding valid bytes is readable.
+
+#include <pgmspace.h>
+
+#ifndef pgm_read_pointer
+ #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+#endif
+
+// GFX_FLOODFILL_STACK: pending spans in floodFill(), kept on the stack.
+// Busy areas with text need about 64 to be filled completely.
+#ifndef GFX_FLOODFILL_STACK
+ #define GFX_FLOODFILL_STACK 64
+#endif
+
+class GFXflashReader {
+ public:
+  GFXflashReader(const uint8_t *addr) { seek(addr); }
+  inline void seek(const uint8_t *addr) {
+    uint8_t ofs = (uintptr_t)addr & 3;
+    _addr = (const uint32_t *)(addr - ofs);
+    _word = *_addr++ >> (ofs * 8); // Little endian: first byte is the LSB
+    _left = 4 - ofs;
+  }
+  inline uint8_t read(void) {
+    if(!_left) {
+      _word = *_addr++;
+      _left = 4;
+    }
+    uint8_t b = _word;
+    _word >>= 8;
+    _left--;
+    return b;
+  }
+ private:
+  const uint32_t *_addr;
+  uint32_t        _word;
+  uint8_t         _left;
+};
+
+static inline uint8_t gfxBitMask(uint8_t bit) {
+  return 0x80 >> bit;
+}
+
+#endif // _GFXBACKEND_ESP8266_H
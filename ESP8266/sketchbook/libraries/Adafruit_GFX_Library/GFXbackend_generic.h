@@ -0,0 +1,67 @@
+#ifndef _GFXBACKEND_GENERIC_H
+#define _GFXBACKEND_GENERIC_H
+
+// Generic backend for other boards (ARM, ESP32, host builds): PROGMEM is
+// ordinary memory, unless the core says otherwise, and shifts are cheap.
+
+#include <string.h>
+#if defined(ESP32)
+ #include <pgmspace.h>
+#endif
+
+// Many (but maybe not all) non-AVR board installs define macros
+// for compatibility with existing PROGMEM-reading AVR code.
+// Do our own checks and defines here for good measure...
+#ifndef PROGMEM
+ #define PROGMEM
+#endif
+#ifndef pgm_read_byte
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+#ifndef pgm_read_dword
+ #define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#endif
+
+// String helpers used on PROGMEM text (GFXtextcache), same as above.
+#ifndef strlen_P
+ #define strlen_P(s) strlen(s)
+#endif
+#ifndef strchr_P
+ #define strchr_P(s, c) strchr(s, c)
+#endif
+#ifndef memcmp_P
+ #define memcmp_P(a, b, n) memcmp(a, b, n)
+#endif
+#ifndef memcpy_P
+ #define memcpy_P(d, s, n) memcpy(d, s, n)
+#endif
+
+// Pointers are a peculiar case...16, 32 or 64 bits depending on the
+// board (or host), so read them at their own size.
+#ifndef pgm_read_pointer
+ #define pgm_read_pointer(addr) (*(void * const *)(addr))
+#endif
+
+// GFX_FLOODFILL_STACK: pending spans in floodFill(), kept on the stack.
+// Busy areas with text need about 64 to be filled completely.
+#ifndef GFX_FLOODFILL_STACK
+ #define GFX_FLOODFILL_STACK 64
+#endif
+
+class GFXflashReader {
+ public:
+  GFXflashReader(const uint8_t *addr) { seek(addr); }
+  inline void    seek(const uint8_t *addr) { _addr = addr; }
+  inline uint8_t read(void) { return pgm_read_byte(_addr++); }
+ private:
+  const uint8_t *_addr;
+};
+
+static inline uint8_t gfxBitMask(uint8_t bit) {
+  return 0x80 >> bit;
+}
+
+#endif // _GFXBACKEND_GENERIC_H
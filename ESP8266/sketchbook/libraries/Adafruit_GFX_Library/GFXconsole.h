@@ -0,0 +1,58 @@
+#ifndef _GFXCONSOLE_H
+#define _GFXCONSOLE_H
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+ #include "Print.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "Adafruit_GFX.h"
+
+// Scrolling text console using the classic 6x8 font.
+// Text lines are kept in a ring; a new line only draws that line. When the
+// display can remap rows (setDisplayStartLine) the framebuffer is a ring too
+// and scrolling just moves the start line. Otherwise visible lines are
+// redrawn from the line buffer, which is still cheaper than moving pixels
+// through getPixel/dispCopy.
+class GFXconsole : public Print {
+
+ public:
+  GFXconsole(Adafruit_GFX *gfx, uint8_t textsize = 1);
+  ~GFXconsole(void);
+
+  boolean begin(void);  // false if the line buffer can't be allocated
+  void
+    clear(void),
+    setTextColor(uint16_t c, uint16_t bg);
+
+#if ARDUINO >= 100
+  virtual size_t write(uint8_t);
+#else
+  virtual void   write(uint8_t);
+#endif
+
+  uint8_t
+    getCols(void) const,
+    getRows(void) const;
+  boolean hasHardwareScroll(void) const;
+
+ private:
+  void
+    newLine(void),
+    drawRow(uint8_t row);
+  int16_t rowY(uint8_t row) const;
+  char *line(uint8_t row) const;
+
+  Adafruit_GFX *_gfx;
+  char *_lines;     // _rows lines of _cols chars, ring starting at _first
+  uint16_t _fg, _bg;
+  uint8_t
+    _size,
+    _cols, _rows,
+    _first,         // ring index of the top visible line
+    _row, _col;     // cursor: visible row and column
+  boolean _hwScroll;
+};
+
+#endif // _GFXCONSOLE_H
@@ -0,0 +1,87 @@
+#ifndef _GFXIMAGE_H
+#define _GFXIMAGE_H
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+ #include "Stream.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "Adafruit_GFX.h"
+
+// Size of the read buffer (at most 255), the stream is read in chunks of
+// this many bytes
+#ifndef GFX_IMAGE_CHUNK
+ #define GFX_IMAGE_CHUNK 64
+#endif
+
+// Error codes returned by getError()
+#define GFX_IMAGE_OK        0
+#define GFX_IMAGE_FORMAT    1 // Not a supported PBM/PGM/BMP file
+#define GFX_IMAGE_TRUNCATED 2 // Stream ended before the last row
+#define GFX_IMAGE_NOMEM     3 // No RAM for the row buffer
+
+// Streaming decoder for monochrome and gray images, e.g. from a SPIFFS or
+// SD File. Rows are decoded from a small read buffer and drawn as soon as
+// they are complete, so only one row of pixels is kept in RAM.
+// Supported are binary PBM (P4) and PGM (P5), BMP with 1, 4 or 8 bits
+// per pixel (uncompressed or RLE compressed) and uncompressed 24 bit BMP.
+// Gray levels, colored palettes and true colors are reduced to ink and
+// paper with the same 8x8 ordered dither as grayPattern(). Ink is drawn in
+// color, paper in bg (bg == color leaves paper transparent).
+class GFXimage {
+
+ public:
+  GFXimage(Adafruit_GFX *gfx);
+
+  // Draw the image with its top left corner at (x, y)
+  boolean draw(Stream *s, int16_t x, int16_t y, uint16_t color, uint16_t bg);
+
+  // Results of the last draw()
+  uint8_t  getError(void) const;
+  int16_t
+    width(void) const,
+    height(void) const;
+  uint32_t
+    getBytes(void) const,   // Bytes read from the stream
+    getMicros(void) const,  // Time spent in draw()
+    getBytesPerSecond(void) const;
+
+ private:
+  boolean
+    fail(uint8_t error),
+    drawPNM(char type),
+    drawBMP(void),
+    allocRow(void),
+    readHeader(uint8_t *buf, uint8_t len),
+    skipTo(uint32_t offset),
+    readRow(int16_t row),
+    readRowRLE(int16_t row);
+  int16_t read(void);
+  int32_t readNumber(void);
+  void
+    ink(uint16_t col, int16_t row, uint8_t gray),
+    drawRow(int16_t row);
+
+  Adafruit_GFX *_gfx;
+  Stream   *_stream;
+  uint8_t
+    *_row,          // One row of ink bits, MSB first
+    *_pal,          // Gray level of each palette index
+    _buf[GFX_IMAGE_CHUNK],
+    _pos, _len,     // Read position and fill of _buf
+    _bpp, _rle,     // Bits per pixel, RLE compressed
+    _error;
+  int16_t
+    _mono,          // XOR for 1bpp rows copied as is, -1 when dithered
+    _x, _y, _w, _h;
+  uint16_t
+    _color, _bg,
+    _rleCol,        // Column the next RLE row starts at
+    _rleSkip;       // Empty RLE rows before the next coded one
+  uint32_t
+    _stride,        // Bytes per row in the stream
+    _bytes, _micros;
+};
+
+#endif // _GFXIMAGE_H
@@ -0,0 +1,236 @@
+/*
+Cache of pre-rendered text sprites for static labels.
+
+Each entry is packed into the arena as a header, the key text and a 1bpp
+bitmap (MSB first, rows padded to whole bytes) of the text at size 1.
+Entries are kept contiguous: evicting one moves the entries behind it
+down, so the free space is always one block at the end of the arena.
+Headers are copied in and out with memcpy, so the arena needs no alignment.
+*/
+
+#include "GFXtextcache.h"
+
+struct GFXtextEntry {
+  uint16_t bytes;     // Whole entry: header, text and bitmap
+  uint16_t stamp;     // Value of _clock at last use
+  const GFXfont *font;
+  int16_t  x1, y1,    // Bitmap origin relative to the cursor
+           adv;       // Cursor advance
+  uint16_t w, h;      // Bitmap size
+  uint8_t  len;       // Text length, the text follows the header
+};
+
+// Renders into a 1bpp bitmap, or only measures text when buf is NULL
+class GFXtextSprite : public Adafruit_GFX {
+ public:
+  GFXtextSprite(int16_t w, int16_t h, uint8_t *buf) : Adafruit_GFX(w, h) {
+    _buf = buf;
+  }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if(_buf && color && (x >= 0) && (y >= 0) && (x < WIDTH) && (y < HEIGHT))
+      _buf[y * ((WIDTH + 7) / 8) + (x / 8)] |= gfxBitMask(x & 7);
+  }
+  uint16_t getPixel(int16_t x, int16_t y) {
+    if(!_buf || (x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT)) return 0;
+    return (_buf[y * ((WIDTH + 7) / 8) + (x / 8)] & gfxBitMask(x & 7)) ? 1 : 0;
+  }
+ private:
+  uint8_t *_buf;
+};
+
+// setFont() moves the cursor when switching from the classic font, so the
+// font is set before the cursor.
+static void spritePrint(GFXtextSprite *sprite, const char *s, boolean flash) {
+  sprite->setTextWrap(false);
+  sprite->setTextColor(1); // Transparent: only text pixels are set
+  if(flash) sprite->print((const __FlashStringHelper *)s);
+  else      sprite->print(s);
+}
+
+// Draw one bitmap row as runs of equal pixels. Whole bytes that continue
+// the current run are skipped without looking at single bits.
+static void blitRow(Adafruit_GFX *gfx, const uint8_t *row, uint16_t w,
+  int16_t x, int16_t y, uint8_t size, uint16_t color, uint16_t bg,
+  boolean opaque) {
+  uint16_t i = 0, start = 0;
+  uint8_t  bits = 0, on = 0, px;
+
+  for(;;) {
+    px = 0;
+    if(i < w) {
+      if(!(i & 7)) {
+        bits = *row++;
+        if((bits == (on ? 0xFF : 0x00)) && (i + 8 <= w)) {
+          i += 8;
+          continue;
+        }
+      }
+      px    = bits & 0x80;
+      bits <<= 1;
+    }
+    if((i == w) || (!px != !on)) {
+      if((on || opaque) && (i > start)) {
+        if(size == 1) gfx->writeFastHLine(x + start, y, i - start,
+                        on ? color : bg);
+        else          gfx->writeFillRect(x + start * size, y,
+                        (i - start) * size, size, on ? color : bg);
+      }
+      if(i == w) break;
+      start = i;
+      on    = px;
+    }
+    i++;
+  }
+}
+
+GFXtextCache::GFXtextCache(void *arena, uint16_t size) {
+  _arena = (uint8_t *)arena;
+  _size  = size;
+  _clock = 0;
+  clear();
+}
+
+void GFXtextCache::clear(void) {
+  _used  = 0;
+  _count = 0;
+}
+
+uint8_t GFXtextCache::getCount(void) const {
+  return _count;
+}
+
+uint16_t GFXtextCache::getFree(void) const {
+  return _size - _used;
+}
+
+boolean GFXtextCache::draw(Adafruit_GFX *gfx, int16_t x, int16_t y,
+  const char *s, const GFXfont *f, uint8_t size, uint16_t color, uint16_t bg) {
+  return draw(gfx, x, y, s, false, f, size, color, bg);
+}
+
+boolean GFXtextCache::draw(Adafruit_GFX *gfx, int16_t x, int16_t y,
+  const __FlashStringHelper *s, const GFXfont *f, uint8_t size,
+  uint16_t color, uint16_t bg) {
+  return draw(gfx, x, y, (const char *)s, true, f, size, color, bg);
+}
+
+boolean GFXtextCache::draw(Adafruit_GFX *gfx, int16_t x, int16_t y,
+  const char *s, boolean flash, const GFXfont *f, uint8_t size,
+  uint16_t color, uint16_t bg) {
+  size_t   n = flash ? strlen_P(s) : strlen(s);
+  uint8_t *p = NULL;
+
+  if(size < 1) size = 1;
+  gfx->setFont(f);
+  gfx->setTextSize(size);
+  gfx->setTextColor(color, bg);
+  gfx->setTextWrap(false);
+
+  // Single lines only, multi-line text doesn't make a sprite
+  if((n < 256) && !(flash ? strchr_P(s, '\n') : strchr(s, '\n'))) {
+    if(!(p = find(s, n, flash, f))) p = add(s, n, flash, f);
+  }
+  if(!p) {
+    gfx->setCursor(x, y);
+    if(flash) gfx->print((const __FlashStringHelper *)s);
+    else      gfx->print(s);
+    return false;
+  }
+
+  GFXtextEntry e;
+  memcpy(&e, p, sizeof(e));
+  e.stamp = ++_clock;
+  memcpy(p, &e, sizeof(e));
+
+  // Blit the rows as runs. The classic font draws its background with an
+  // opaque color; custom fonts never draw background pixels.
+  const uint8_t *bits = p + sizeof(e) + e.len;
+  uint16_t bw = (e.w + 7) / 8;
+  boolean  opaque = !f && (bg != color);
+  int16_t  sx = x + e.x1 * size,
+           sy = y + e.y1 * size;
+
+  gfx->startWrite();
+  for(uint16_t r=0; r<e.h; r++, bits += bw) {
+    int16_t yy = sy + r * size;
+    if(yy >= gfx->height()) break;
+    if(yy + size > 0) blitRow(gfx, bits, e.w, sx, yy, size, color, bg, opaque);
+  }
+  gfx->endWrite();
+  gfx->setCursor(x + e.adv * size, y);
+  return true;
+}
+
+uint8_t *GFXtextCache::find(const char *s, uint8_t len, boolean flash,
+  const GFXfont *f) {
+  GFXtextEntry e;
+
+  for(uint8_t *p = _arena; p < _arena + _used; p += e.bytes) {
+    memcpy(&e, p, sizeof(e));
+    if((e.font == f) && (e.len == len) && !(flash ?
+      memcmp_P(p + sizeof(e), s, len) : memcmp(p + sizeof(e), s, len)))
+      return p;
+  }
+  return NULL;
+}
+
+uint8_t *GFXtextCache::add(const char *s, uint8_t len, boolean flash,
+  const GFXfont *f) {
+  GFXtextEntry e;
+  uint16_t     w, h;
+
+  // Measure at size 1 from cursor (0,0)
+  GFXtextSprite measure(0x7FFF, 0x7FFF, NULL);
+  measure.setFont(f);
+  measure.setTextWrap(false);
+  if(flash) measure.getTextBounds((const __FlashStringHelper *)s, 0, 0,
+              &e.x1, &e.y1, &w, &h);
+  else      measure.getTextBounds((char *)s, 0, 0, &e.x1, &e.y1, &w, &h);
+  measure.setCursor(0, 0);
+  spritePrint(&measure, s, flash);
+  e.adv  = measure.getCursorX();
+  e.w    = w;
+  e.h    = h;
+  e.font = f;
+  e.len  = len;
+
+  uint32_t need = sizeof(e) + len + (uint32_t)((w + 7) / 8) * h;
+  if(need > _size) return NULL;
+  while((uint16_t)(_size - _used) < need) evictOldest();
+
+  uint8_t *p = _arena + _used;
+  e.bytes = need;
+  e.stamp = _clock;
+  memcpy(p, &e, sizeof(e));
+  if(flash) memcpy_P(p + sizeof(e), s, len);
+  else      memcpy(p + sizeof(e), s, len);
+  memset(p + sizeof(e) + len, 0, need - sizeof(e) - len);
+  if(w && h) {
+    GFXtextSprite sprite(w, h, p + sizeof(e) + len);
+    sprite.setFont(f);
+    sprite.setCursor(-e.x1, -e.y1);
+    spritePrint(&sprite, s, flash);
+  }
+  _used += need;
+  _count++;
+  return p;
+}
+
+void GFXtextCache::evictOldest(void) {
+  GFXtextEntry e;
+  uint8_t     *oldest = NULL;
+  uint16_t     age = 0, bytes = 0;
+
+  for(uint8_t *p = _arena; p < _arena + _used; p += e.bytes) {
+    memcpy(&e, p, sizeof(e));
+    if(!oldest || ((uint16_t)(_clock - e.stamp) >= age)) {
+      oldest = p;
+      age    = _clock - e.stamp;
+      bytes  = e.bytes;
+    }
+  }
+  if(!oldest) return;
+  memmove(oldest, oldest + bytes, (_arena + _used) - (oldest + bytes));
+  _used -= bytes;
+  _count--;
+}
@@ -0,0 +1,52 @@
+#ifndef _GFXTEXTCACHE_H
+#define _GFXTEXTCACHE_H
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "Adafruit_GFX.h"
+
+// Cache of pre-rendered text for static labels.
+// A string is rasterized once into a 1bpp sprite kept in a caller supplied
+// arena, keyed by text and font. Later draws blit the sprite row by row as
+// runs (writeFastHLine/writeFillRect) instead of decoding the glyphs again.
+// Sprites are stored at text size 1 and scaled while blitting, so one entry
+// serves all sizes. When the arena is full the least recently used entries
+// are evicted. Text with a newline or too big for the arena is printed
+// directly.
+class GFXtextCache {
+
+ public:
+  GFXtextCache(void *arena, uint16_t size);
+
+  // Same result as setFont(f), setTextSize(size), setTextColor(color, bg),
+  // setCursor(x, y) and print(s), with wrapping off. Returns true if the
+  // text came from (or was added to) the cache.
+  boolean
+    draw(Adafruit_GFX *gfx, int16_t x, int16_t y, const char *s,
+      const GFXfont *f, uint8_t size, uint16_t color, uint16_t bg),
+    draw(Adafruit_GFX *gfx, int16_t x, int16_t y, const __FlashStringHelper *s,
+      const GFXfont *f, uint8_t size, uint16_t color, uint16_t bg);
+  void clear(void);
+
+  uint8_t  getCount(void) const; // Number of cached sprites
+  uint16_t getFree(void) const;  // Unused arena bytes
+
+ private:
+  boolean draw(Adafruit_GFX *gfx, int16_t x, int16_t y, const char *s,
+    boolean flash, const GFXfont *f, uint8_t size, uint16_t color, uint16_t bg);
+  uint8_t *find(const char *s, uint8_t len, boolean flash, const GFXfont *f);
+  uint8_t *add(const char *s, uint8_t len, boolean flash, const GFXfont *f);
+  void evictOldest(void);
+
+  uint8_t *_arena;
+  uint16_t
+    _size,
+    _used,          // Entries are packed from the start of the arena
+    _clock;         // Use counter for LRU
+  uint8_t _count;
+};
+
+#endif // _GFXTEXTCACHE_H
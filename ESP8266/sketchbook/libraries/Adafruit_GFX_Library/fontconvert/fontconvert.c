@@ -8,6 +8,20 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+Batch mode converts all fonts listed in a manifest, see makefonts.sh:
+  ./fontconvert -b fonts.txt [-j jobs] [-o outpath]
+Each manifest line holds a font file, its sizes and optionally char
+ranges (first-last, default 32-126) and -r; every size is made for every
+range.  '#' starts a comment.  For example:
+  freefont/FreeSans.ttf 9 12 18 24
+  freefont/FreeMono.ttf 12 32-255 -r
+Lines are spread over a pool of worker threads (one per CPU core unless
+-j is given).  A worker loads the font of a line once and renders all of
+its sizes.  Headers are named after the font like in single mode and
+written to a temporary file first, then renamed, so an interrupted run
+never leaves a partial header behind.  A manifest of '-' is read from
+stdin.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -18,108 +32,105 @@ See notes at end for glyph nomenclature & other tidbits.
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
 #include <ft2build.h>
 #include FT_GLYPH_H
 #include "../gfxfont.h" // Adafruit_GFX font structures
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
-// Accumulate bits for output, with periodic hexadecimal byte write
-void enbit(uint8_t value) {
-	static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
-	if(value) sum |= bit;    // Set bit if needed
-	if(!(bit >>= 1)) {       // Advance to next bit, end of byte reached?
-		if(!firstCall) { // Format output table nicely
-			if(++row >= 12) {        // Last entry on line?
-				printf(",\n  "); //   Newline format output
-				row = 0;         //   Reset row counter
-			} else {                 // Not end of line
-				printf(", ");    //   Simple comma delim
-			}
-		}
-		printf("0x%02X", sum); // Write byte value
-		sum       = 0;         // Clear for next byte
-		bit       = 0x80;      // Reset bit counter
-		firstCall = 0;         // Formatting flag
-	}
-}
-
-int main(int argc, char *argv[]) {
-	int                i, j, err, size, first=' ', last='~',
-	                   bitmapOffset = 0, x, y, byte;
-	char              *fontName, c, *ptr;
-	FT_Library         library;
-	FT_Face            face;
-	FT_Glyph           glyph;
-	FT_Bitmap         *bitmap;
-	FT_BitmapGlyphRec *g;
-	GFXglyph          *table;
-	uint8_t            bit;
+#define MAX_SIZES  16 // Sizes per manifest line
+#define MAX_RANGES 4  // Char ranges per manifest line
 
-	// Parse command line.  Valid syntaxes are:
-	//   fontconvert [filename] [size]
-	//   fontconvert [filename] [size] [last char]
-	//   fontconvert [filename] [size] [first char] [last char]
-	// Unless overridden, default first and last chars are
-	// ' ' (space) and '~', respectively
+typedef struct { // Bit accumulator of one output file
+	FILE   *out;
+	uint8_t row, sum, bit, firstCall;
+} BitWriter;
 
-	if(argc < 3) {
-		fprintf(stderr, "Usage: %s fontfile size [first] [last]\n",
-		  argv[0]);
-		return 1;
-	}
+typedef struct { // One manifest line
+	char *fileName;
+	int   sizes, size[MAX_SIZES],
+	      ranges, first[MAX_RANGES], last[MAX_RANGES],
+	      rowAligned, line;
+} Job;
 
-	size = atoi(argv[2]);
+typedef struct { // Work shared by the batch threads
+	Job             *jobs;
+	int              count, next, errors;
+	const char      *outPath;
+	pthread_mutex_t  lock;
+} Batch;
 
-	if(argc == 4) {
-		last  = atoi(argv[3]);
-	} else if(argc == 5) {
-		first = atoi(argv[3]);
-		last  = atoi(argv[4]);
-	}
-
-	if(last < first) {
-		i     = first;
-		first = last;
-		last  = i;
+// Accumulate bits for output, with periodic hexadecimal byte write
+void enbit(BitWriter *w, uint8_t value) {
+	if(value) w->sum |= w->bit; // Set bit if needed
+	if(!(w->bit >>= 1)) {       // Advance to next bit, end of byte reached?
+		if(!w->firstCall) { // Format output table nicely
+			if(++w->row >= 12) {          // Last entry on line?
+				fprintf(w->out, ",\n  "); //   Newline format output
+				w->row = 0;               //   Reset row counter
+			} else {                      // Not end of line
+				fprintf(w->out, ", ");    //   Simple comma delim
+			}
+		}
+		fprintf(w->out, "0x%02X", w->sum); // Write byte value
+		w->sum       = 0;                 // Clear for next byte
+		w->bit       = 0x80;              // Reset bit counter
+		w->firstCall = 0;                 // Formatting flag
 	}
+}
 
-	ptr = strrchr(argv[1], '/'); // Find last slash in filename
-	if(ptr) ptr++;         // First character of filename (path stripped)
-	else    ptr = argv[1]; // No path; font in local dir.
+// Derive font table names from filename.  Path and period (filename
+// extension) are stripped and replaced with the font size & bits.
+// Returns a malloc()ed name.
+char *makeName(const char *fileName, int size, int last, int rowAligned) {
+	const char *ptr;
+	char       *fontName, *ext, c;
+	int         i;
 
-	// Allocate space for font name and glyph table
-	if((!(fontName = malloc(strlen(ptr) + 20))) ||
-	   (!(table = (GFXglyph *)malloc((last - first + 1) *
-	    sizeof(GFXglyph))))) {
-		fprintf(stderr, "Malloc error\n");
-		return 1;
-	}
+	ptr = strrchr(fileName, '/'); // Find last slash in filename
+	if(ptr) ptr++;           // First character of filename (path stripped)
+	else    ptr = fileName;  // No path; font in local dir.
 
-	// Derive font table names from filename.  Period (filename
-	// extension) is truncated and replaced with the font size & bits.
+	if(!(fontName = malloc(strlen(ptr) + 20))) return NULL;
 	strcpy(fontName, ptr);
-	ptr = strrchr(fontName, '.'); // Find last period (file ext)
-	if(!ptr) ptr = &fontName[strlen(fontName)]; // If none, append
+	ext = strrchr(fontName, '.'); // Find last period (file ext)
+	if(!ext) ext = &fontName[strlen(fontName)]; // If none, append
 	// Insert font size and 7/8 bit.  fontName was alloc'd w/extra
 	// space to allow this, we're not sprintfing into Forbidden Zone.
-	sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+	sprintf(ext, "%dpt%db%s", size, (last > 127) ? 8 : 7,
+	  rowAligned ? "r" : "");
 	// Space and punctuation chars in name replaced w/ underscores.  
 	for(i=0; (c=fontName[i]); i++) {
-		if(isspace(c) || ispunct(c)) fontName[i] = '_';
+		if(isspace((unsigned char)c) || ispunct((unsigned char)c)) {
+			fontName[i] = '_';
+		}
 	}
+	return fontName;
+}
 
-	// Init FreeType lib, load font
-	if((err = FT_Init_FreeType(&library))) {
-		fprintf(stderr, "FreeType init error: %d", err);
-		return err;
-	}
-	if((err = FT_New_Face(library, argv[1], 0, &face))) {
-		fprintf(stderr, "Font load error: %d", err);
-		FT_Done_FreeType(library);
-		return err;
+// Write the font header for chars first..last of face at the given size.
+// Returns 0, or 1 on a malloc error.
+int convert(FT_Face face, const char *fontName, int size, int first,
+  int last, int rowAligned, FILE *out) {
+	int                i, j, err, bitmapOffset = 0, packedBytes = 0,
+	                   x, y, byte;
+	FT_Glyph           glyph;
+	FT_Bitmap         *bitmap;
+	FT_BitmapGlyphRec *g;
+	GFXglyph          *table;
+	uint8_t            bit;
+	BitWriter          w = { out, 0, 0, 0x80, 1 };
+
+	if(!(table = (GFXglyph *)malloc((last - first + 1) *
+	    sizeof(GFXglyph)))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
 	}
 
 	// << 6 because '26dot6' fixed-point format
@@ -131,10 +142,14 @@ int main(int argc, char *argv[]) {
 	// the right symbols, and that's not done yet.
 	// fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
-	printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+	fprintf(out, "const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
 	// Process glyphs and output huge bitmap data array
 	for(i=first, j=0; i<=last; i++, j++) {
+		// Chars that fail below get an empty glyph
+		memset(&table[j], 0, sizeof(GFXglyph));
+		table[j].bitmapOffset = bitmapOffset;
+
 		// MONO renderer provides clean image with perfect crop
 		// (no wasted pixels) via bitmap struct.
 		if((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
@@ -161,8 +176,8 @@ int main(int argc, char *argv[]) {
 
 		// Minimal font and per-glyph information is stored to
 		// reduce flash space requirements.  Glyph bitmaps are
-		// fully bit-packed; no per-scanline pad, though end of
-		// each character may be padded to next byte boundary
+		// fully bit-packed; no per-scanline pad (unless -r), though
+		// end of each character may be padded to next byte boundary
 		// when needed.  16-bit offset means 64K max for bitmaps,
 		// code currently doesn't check for overflow.  (Doesn't
 		// check that size & offsets are within bounds either for
@@ -178,28 +193,35 @@ int main(int argc, char *argv[]) {
 			for(x=0;x < bitmap->width; x++) {
 				byte = x / 8;
 				bit  = 0x80 >> (x & 7);
-				enbit(bitmap->buffer[
+				enbit(&w, bitmap->buffer[
 				  y * bitmap->pitch + byte] & bit);
 			}
+			// Pad each row to the next byte boundary with -r
+			for(x=bitmap->width; rowAligned && (x & 7); x++) {
+				enbit(&w, 0);
+			}
 		}
 
 		// Pad end of char bitmap to next byte boundary if needed
 		int n = (bitmap->width * bitmap->rows) & 7;
-		if(n) { // Pixel count not an even multiple of 8?
+		if(n && !rowAligned) { // Pixel count not an even multiple of 8?
 			n = 8 - n; // # bits to next multiple
-			while(n--) enbit(0);
+			while(n--) enbit(&w, 0);
 		}
-		bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+		packedBytes  += (bitmap->width * bitmap->rows + 7) / 8;
+		bitmapOffset += rowAligned ?
+		  (bitmap->width + 7) / 8 * bitmap->rows :
+		  (bitmap->width * bitmap->rows + 7) / 8;
 
 		FT_Done_Glyph(glyph);
 	}
 
-	printf(" };\n\n"); // End bitmap array
+	fprintf(out, " };\n\n"); // End bitmap array
 
 	// Output glyph attributes table (one per character)
-	printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
+	fprintf(out, "const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
 	for(i=first, j=0; i<=last; i++, j++) {
-		printf("  { %5d, %3d, %3d, %3d, %4d, %4d }",
+		fprintf(out, "  { %5d, %3d, %3d, %3d, %4d, %4d }",
 		  table[j].bitmapOffset,
 		  table[j].width,
 		  table[j].height,
@@ -207,33 +229,342 @@ int main(int argc, char *argv[]) {
 		  table[j].xOffset,
 		  table[j].yOffset);
 		if(i < last) {
-			printf(",   // 0x%02X", i);
+			fprintf(out, ",   // 0x%02X", i);
 			if((i >= ' ') && (i <= '~')) {
-				printf(" '%c'", i);
+				fprintf(out, " '%c'", i);
 			}
-			putchar('\n');
+			fputc('\n', out);
 		}
 	}
-	printf(" }; // 0x%02X", last);
-	if((last >= ' ') && (last <= '~')) printf(" '%c'", last);
-	printf("\n\n");
+	fprintf(out, " }; // 0x%02X", last);
+	if((last >= ' ') && (last <= '~')) fprintf(out, " '%c'", last);
+	fprintf(out, "\n\n");
 
 	// Output font structure
-	printf("const GFXfont %s PROGMEM = {\n", fontName);
-	printf("  (uint8_t  *)%sBitmaps,\n", fontName);
-	printf("  (GFXglyph *)%sGlyphs,\n", fontName);
-	printf("  0x%02X, 0x%02X, %ld };\n\n",
-	  first, last, face->size->metrics.height >> 6);
-	printf("// Approx. %d bytes\n",
-	  bitmapOffset + (last - first + 1) * 7 + 7);
+	fprintf(out, "const GFXfont %s PROGMEM = {\n", fontName);
+	fprintf(out, "  (uint8_t  *)%sBitmaps,\n", fontName);
+	fprintf(out, "  (GFXglyph *)%sGlyphs,\n", fontName);
+	fprintf(out, "  0x%02X, 0x%02X, %ld%s };\n\n",
+	  first, last, (long)(face->size->metrics.height >> 6),
+	  rowAligned ? ", GFX_FONT_ROWALIGNED" : "");
+	fprintf(out, "// Approx. %d bytes\n",
+	  bitmapOffset + (last - first + 1) * 7 + 10);
+	if(rowAligned) { // Flash cost of the row padding
+		fprintf(out, "// Row alignment adds %d bytes to %d bit-packed\n",
+		  bitmapOffset - packedBytes, packedBytes);
+	}
 	// Size estimate is based on AVR struct and pointer sizes;
 	// actual size may vary.
 
-	FT_Done_FreeType(library);
-
+	free(table);
 	return 0;
 }
 
+// Parse one manifest line into job.  Returns 1 for a job, 0 for an empty
+// or comment line, -1 on an error.
+int parseLine(char *text, int line, Job *job) {
+	char *tok, *end;
+	long  n, m;
+
+	memset(job, 0, sizeof(Job));
+	job->line = line;
+	if((tok = strchr(text, '#'))) *tok = 0; // Strip comment
+	for(tok = strtok(text, " \t\r\n"); tok; tok = strtok(NULL, " \t\r\n")) {
+		if(!job->fileName) {
+			if(!(job->fileName = strdup(tok))) return -1;
+		} else if(!strcmp(tok, "-r")) {
+			job->rowAligned = 1;
+		} else if(((n = strtol(tok, &end, 0)) > 0) && !*end) {
+			if(job->sizes >= MAX_SIZES) return -1;
+			job->size[job->sizes++] = n;
+		} else if((*end == '-') && ((m = strtol(end + 1, &end, 0)) >= n) &&
+		  !*end && (n >= 0) && (m <= 255)) {
+			if(job->ranges >= MAX_RANGES) return -1;
+			job->first[job->ranges] = n;
+			job->last[job->ranges++] = m;
+		} else {
+			return -1;
+		}
+	}
+	if(!job->fileName) return 0;
+	if(!job->sizes) return -1;
+	if(!job->ranges) { // Default range is printable 7-bit ASCII
+		job->first[0] = ' ';
+		job->last[0]  = '~';
+		job->ranges   = 1;
+	}
+	return 1;
+}
+
+// Convert all sizes and ranges of one manifest line.  Each header goes
+// to outPath/name.h.tmp first and is renamed when complete.  Returns the
+// number of failed headers.
+int runJob(FT_Library library, Job *job, const char *outPath) {
+	FT_Face face;
+	FILE   *out;
+	char   *fontName, *path, *tmp;
+	int     s, r, err, errors = 0;
+	size_t  len;
+
+	if((err = FT_New_Face(library, job->fileName, 0, &face))) {
+		fprintf(stderr, "%s: font load error %d\n", job->fileName, err);
+		return job->sizes * job->ranges;
+	}
+	for(s=0; s<job->sizes; s++) {
+		for(r=0; r<job->ranges; r++) {
+			fontName = makeName(job->fileName, job->size[s],
+			  job->last[r], job->rowAligned);
+			len      = fontName ? strlen(outPath) + strlen(fontName) : 0;
+			path     = fontName ? malloc(len + 4)  : NULL; // "/.h"
+			tmp      = path     ? malloc(len + 8)  : NULL; // ".tmp"
+			if(!tmp) {
+				fprintf(stderr, "Malloc error\n");
+				errors++;
+			} else {
+				sprintf(path, "%s/%s.h", outPath, fontName);
+				sprintf(tmp, "%s.tmp", path);
+				if(!(out = fopen(tmp, "w"))) {
+					fprintf(stderr, "Can't write %s\n", tmp);
+					errors++;
+				} else if(convert(face, fontName, job->size[s],
+				  job->first[r], job->last[r], job->rowAligned, out) |
+				  ferror(out) | fclose(out)) {
+					fprintf(stderr, "Error writing %s\n", tmp);
+					remove(tmp);
+					errors++;
+				} else {
+#ifdef _WIN32
+					remove(path); // rename() does not replace files here
+#endif
+					if(rename(tmp, path)) {
+						fprintf(stderr, "Can't rename %s\n", tmp);
+						remove(tmp);
+						errors++;
+					}
+				}
+			}
+			free(tmp);
+			free(path);
+			free(fontName);
+		}
+	}
+	FT_Done_Face(face);
+	return errors;
+}
+
+// Batch worker thread: take the next manifest line until none are left.
+// FreeType objects can't be shared between threads, so each worker has
+// its own library instance.
+void *worker(void *arg) {
+	Batch     *batch = (Batch *)arg;
+	FT_Library library;
+	int        i, err, errors = 0;
+
+	if((err = FT_Init_FreeType(&library))) {
+		fprintf(stderr, "FreeType init error: %d\n", err);
+		library = NULL;
+	}
+	for(;;) {
+		pthread_mutex_lock(&batch->lock);
+		batch->errors += errors;
+		i = batch->next++;
+		pthread_mutex_unlock(&batch->lock);
+		if(i >= batch->count) break;
+		errors = library ? runJob(library, &batch->jobs[i], batch->outPath) :
+		  batch->jobs[i].sizes * batch->jobs[i].ranges;
+	}
+	if(library) FT_Done_FreeType(library);
+	return NULL;
+}
+
+// Header names only hold the font, size and 7/8 bit, so two ranges of
+// one line or the same font on two lines would write the same file (and
+// two workers would race on it).  Returns 1 after reporting the first
+// duplicate, or on a malloc error.
+int checkNames(Batch *b, const char *manifest) {
+	char **names;
+	int   *lines, i, j, s, r, n = 0, total = 0, result = 0;
+
+	for(i=0; i<b->count; i++) total += b->jobs[i].sizes * b->jobs[i].ranges;
+	names = malloc((total ? total : 1) * sizeof(char *));
+	lines = malloc((total ? total : 1) * sizeof(int));
+	if(!names || !lines) {
+		fprintf(stderr, "Malloc error\n");
+		result = 1;
+	}
+	for(i=0; !result && (i<b->count); i++) {
+		Job *job = &b->jobs[i];
+		for(s=0; !result && (s<job->sizes); s++) {
+			for(r=0; !result && (r<job->ranges); r++) {
+				if(!(names[n] = makeName(job->fileName, job->size[s],
+				  job->last[r], job->rowAligned))) {
+					fprintf(stderr, "Malloc error\n");
+					result = 1;
+					break;
+				}
+				lines[n] = job->line;
+				for(j=0; j<n; j++) {
+					if(!strcmp(names[j], names[n])) {
+						fprintf(stderr, "%s:%d: %s.h is also written by "
+						  "line %d\n", manifest, lines[n], names[n], lines[j]);
+						result = 1;
+						break;
+					}
+				}
+				n++;
+			}
+		}
+	}
+	while(n--) free(names[n]);
+	free(names);
+	free(lines);
+	return result;
+}
+
+// Convert all fonts of a manifest with a pool of worker threads
+int batch(const char *manifest, int threads, const char *outPath) {
+	FILE      *in;
+	char       text[1024];
+	int        i, line = 0, max = 64, result;
+	Batch      b;
+	pthread_t *pool;
+
+	memset(&b, 0, sizeof(b));
+	b.outPath = outPath;
+	if(!(in = strcmp(manifest, "-") ? fopen(manifest, "r") : stdin)) {
+		fprintf(stderr, "Can't open %s\n", manifest);
+		return 1;
+	}
+	if(!(b.jobs = malloc(max * sizeof(Job)))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+	while(fgets(text, sizeof(text), in)) {
+		if(b.count >= max) {
+			max *= 2;
+			if(!(b.jobs = realloc(b.jobs, max * sizeof(Job)))) {
+				fprintf(stderr, "Malloc error\n");
+				return 1;
+			}
+		}
+		if((result = parseLine(text, ++line, &b.jobs[b.count])) < 0) {
+			fprintf(stderr, "%s:%d: bad line, expected: fontfile size... "
+			  "[first-last...] [-r]\n", manifest, line);
+			return 1;
+		}
+		b.count += result;
+	}
+	if(in != stdin) fclose(in);
+	if(checkNames(&b, manifest)) {
+		for(i=0; i<b.count; i++) free(b.jobs[i].fileName);
+		free(b.jobs);
+		return 1;
+	}
+
+	if(threads < 1) threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if(threads > b.count) threads = b.count;
+	if(threads < 1) threads = 1;
+	if(!(pool = malloc(threads * sizeof(pthread_t)))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+	pthread_mutex_init(&b.lock, NULL);
+	for(i=0; i<threads; i++) {
+		if(pthread_create(&pool[i], NULL, worker, &b)) break;
+	}
+	if(!i) worker(&b); // No threads at all, do the work here
+	while(i--) pthread_join(pool[i], NULL);
+	pthread_mutex_destroy(&b.lock);
+
+	for(i=0; i<b.count; i++) free(b.jobs[i].fileName);
+	free(b.jobs);
+	free(pool);
+	if(b.errors) fprintf(stderr, "%d headers failed\n", b.errors);
+	return b.errors ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+	int         i, err, size, first=' ', last='~', rowAligned = 0,
+	            threads = 0;
+	char       *fontName, *manifest = NULL;
+	const char *outPath = ".";
+	FT_Library  library;
+	FT_Face     face;
+
+	// Parse command line.  Valid syntaxes are:
+	//   fontconvert [-r] [filename] [size]
+	//   fontconvert [-r] [filename] [size] [last char]
+	//   fontconvert [-r] [filename] [size] [first char] [last char]
+	//   fontconvert -b [manifest] [-j threads] [-o outpath]
+	// Unless overridden, default first and last chars are
+	// ' ' (space) and '~', respectively.  With -r each row of a glyph
+	// bitmap starts on a byte boundary (GFX_FONT_ROWALIGNED), which is
+	// faster to draw but larger; 'r' is appended to the font name.
+
+	if((argc > 2) && !strcmp(argv[1], "-b")) {
+		manifest = argv[2];
+		for(i=3; i+1<argc; i+=2) {
+			if(!strcmp(argv[i], "-j"))      threads = atoi(argv[i + 1]);
+			else if(!strcmp(argv[i], "-o")) outPath = argv[i + 1];
+			else                            break;
+		}
+		if(i == argc) return batch(manifest, threads, outPath);
+		fprintf(stderr, "Usage: %s -b manifest [-j threads] [-o outpath]\n",
+		  argv[0]);
+		return 1;
+	}
+
+	if((argc > 1) && !strcmp(argv[1], "-r")) {
+		rowAligned = 1;
+		argv++;
+		argc--;
+	}
+
+	if(argc < 3) {
+		fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n"
+		  "       %s -b manifest [-j threads] [-o outpath]\n",
+		  argv[0], argv[0]);
+		return 1;
+	}
+
+	size = atoi(argv[2]);
+
+	if(argc == 4) {
+		last  = atoi(argv[3]);
+	} else if(argc == 5) {
+		first = atoi(argv[3]);
+		last  = atoi(argv[4]);
+	}
+
+	if(last < first) {
+		i     = first;
+		first = last;
+		last  = i;
+	}
+
+	if(!(fontName = makeName(argv[1], size, last, rowAligned))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+
+	// Init FreeType lib, load font
+	if((err = FT_Init_FreeType(&library))) {
+		fprintf(stderr, "FreeType init error: %d", err);
+		return err;
+	}
+	if((err = FT_New_Face(library, argv[1], 0, &face))) {
+		fprintf(stderr, "Font load error: %d", err);
+		FT_Done_FreeType(library);
+		return err;
+	}
+
+	err = convert(face, fontName, size, first, last, rowAligned, stdout);
+
+	FT_Done_FreeType(library);
+	free(fontName);
+
+	return err;
+}
 /* -------------------------------------------------------------------------
 
 Character metrics are slightly different from classic GFX & ftGFX.
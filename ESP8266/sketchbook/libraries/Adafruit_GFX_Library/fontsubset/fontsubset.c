@@ -0,0 +1,396 @@
+/*
+Font subset generator for Adafruit_GFX fonts and Small_Fonts5x6 tables.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that scans the string
+and character literals of a sketch and writes a copy of a font holding
+only the glyphs that are printed.  Build and run with:
+  gcc -o fontsubset fontsubset.c
+  ./fontsubset -x 0123456789 Fonts/FreeSans12pt7b.h clock.ino > clockfont.h
+
+Characters a sketch prints without a literal for them (eg. digits made
+with '0'+n) are added with -x.  Comments, #include lines and other
+preprocessor lines except #define are not scanned.  Literals are C style,
+escapes like \x41 are decoded; -x takes the same escapes.
+
+The font is C source as made by fontconvert (a GFXfont with its Bitmaps
+and Glyphs arrays), or a classic table of fixed size glyphs like
+Small_Fonts5x6: one array of -w bytes per glyph (default 5), starting at
+char -f (default 32).  Names are kept, so the subset header replaces the
+font header without changing the sketch; -n gives a new name.
+
+Both get the used glyphs only, plus a table that maps the chars of the
+used range to their glyph index (0xFF for chars left out):
+- a GFXfont gets nameMap[] and the GFX_FONT_REMAP flag, which setFont()
+  and print() handle like any other font.
+- a classic table gets name_map[] and the range as defines, for the
+  lookup in the sketch's drawChar():
+    #define name_FIRST, name_LAST  range of the used chars
+    name_map[c - name_FIRST]       glyph index of c, 0xFF if left out
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "../gfxfont.h" // Adafruit_GFX font structures
+
+static int count = 0;
+
+// Write one output byte, 12 per line like fontconvert
+void emit(const char *fmt, int value) {
+	if(count) printf((count % 12) ? ", " : ",\n  ");
+	printf(fmt, value);
+	count++;
+}
+
+// Read a file into a zero terminated buffer
+char *load(const char *fileName) {
+	FILE *f = fopen(fileName, "rb");
+	char *text;
+	long  len;
+
+	if(!f) {
+		fprintf(stderr, "Can't open %s\n", fileName);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	if(!(text = malloc(len + 1))) {
+		fprintf(stderr, "Malloc error\n");
+		exit(1);
+	}
+	len = fread(text, 1, len, f);
+	text[len] = 0;
+	fclose(f);
+	return text;
+}
+
+// Skip whitespace, comments and preprocessor lines (#define kept when
+// keepDefine is set).  Returns the next character of interest.
+char *skip(char *p, int keepDefine) {
+	char *q;
+
+	for(;;) {
+		while(isspace((unsigned char)*p)) p++;
+		if((p[0] == '/') && (p[1] == '/')) {
+			while(*p && (*p != '\n')) p++;
+		} else if((p[0] == '/') && (p[1] == '*')) {
+			for(p += 2; *p && !((p[0] == '*') && (p[1] == '/')); p++);
+			if(*p) p += 2;
+		} else if(*p == '#') {
+			for(q = p + 1; (*q == ' ') || (*q == '\t'); q++);
+			if(keepDefine && !strncmp(q, "define", 6)) return q + 6;
+			while(*p && (*p != '\n')) { // Up to an unescaped newline
+				if((*p == '\\') && (p[1] == '\n')) p++;
+				p++;
+			}
+		} else {
+			return p;
+		}
+	}
+}
+
+// Decode one char of a literal, escapes included
+int unescape(char **pp) {
+	char *p = *pp;
+	int   c = (unsigned char)*p++, n;
+
+	if(c == '\\') {
+		c = (unsigned char)*p++;
+		switch(c) {
+			case 'n': c = '\n'; break;
+			case 't': c = '\t'; break;
+			case 'r': c = '\r'; break;
+			case 'a': c = '\a'; break;
+			case 'b': c = '\b'; break;
+			case 'f': c = '\f'; break;
+			case 'v': c = '\v'; break;
+			case 'x':
+				for(c = 0; isxdigit((unsigned char)*p); p++) {
+					c = c * 16 + (isdigit((unsigned char)*p) ?
+					  *p - '0' : (tolower(*p) - 'a' + 10));
+				}
+				break;
+			default:
+				if((c >= '0') && (c <= '7')) {
+					for(c -= '0', n = 1; (n < 3) && (*p >= '0') &&
+					  (*p <= '7'); n++) c = c * 8 + *p++ - '0';
+				}
+		}
+	}
+	*pp = p;
+	return c & 0xFF;
+}
+
+// Mark the chars of all string and character literals in text as used
+void scan(char *text, uint8_t *used) {
+	char *p = text, quote;
+	int   c;
+
+	while(*(p = skip(p, 1))) {
+		if((*p == '"') || (*p == '\'')) {
+			for(quote = *p++; *p && (*p != quote) && (*p != '\n'); ) {
+				c = unescape(&p);
+				if(c >= ' ') used[c] = 1;
+			}
+			if(*p == quote) p++;
+		} else if(isalnum((unsigned char)*p) || (*p == '_')) {
+			while(isalnum((unsigned char)*p) || (*p == '_')) p++;
+		} else {
+			p++;
+		}
+	}
+}
+
+// Collect the numbers between the '{' at or after p and its matching '}'.
+// Identifiers are skipped whole (so no 8 is read from uint8_t), and
+// GFX_FONT_ROWALIGNED counts as its value.  Returns the number of values,
+// *end is set after the '}'.
+int numbers(char *p, long **values, char **end) {
+	int   n = 0, max = 256, depth = 0, neg = 0;
+	char *q;
+
+	if(!p || !(p = strchr(p, '{')) ||
+	   !(*values = malloc(max * sizeof(long)))) return -1;
+	while(*(p = skip(p, 0))) {
+		if(n >= max) {
+			max *= 2;
+			if(!(*values = realloc(*values, max * sizeof(long)))) return -1;
+		}
+		if(*p == '{') {
+			depth++;
+			p++;
+		} else if(*p == '}') {
+			p++;
+			if(!--depth) break;
+		} else if(*p == '-') {
+			neg = 1;
+			p++;
+			continue;
+		} else if(isdigit((unsigned char)*p)) {
+			(*values)[n++] = neg ? -strtol(p, &p, 0) : strtol(p, &p, 0);
+		} else if(isalpha((unsigned char)*p) || (*p == '_')) {
+			for(q = p; isalnum((unsigned char)*p) || (*p == '_'); p++);
+			if((p - q == 19) && !strncmp(q, "GFX_FONT_ROWALIGNED", 19)) {
+				(*values)[n++] = GFX_FONT_ROWALIGNED;
+			}
+		} else {
+			p++;
+		}
+		neg = 0;
+	}
+	*end = p;
+	return depth ? -1 : n;
+}
+
+// Copy the identifier that ends at p (exclusive) into name
+void nameBefore(char *text, char *p, char *name, int size) {
+	char *q;
+
+	while((p > text) && isspace((unsigned char)p[-1])) p--;
+	for(q = p; (q > text) && (isalnum((unsigned char)q[-1]) ||
+	  (q[-1] == '_')); q--);
+	if((p - q > 0) && (p - q < size)) {
+		memcpy(name, q, p - q);
+		name[p - q] = 0;
+	}
+}
+
+// List the subset chars in a comment, 64 per line
+void listChars(uint8_t *keep, int first, int last) {
+	int c, n = 0;
+
+	for(c=first; c<=last; c++) {
+		if(!keep[c]) continue;
+		if(!(n++ % 64)) printf("\n// ");
+		if((c >= ' ') && (c <= '~') && (c != '\\')) putchar(c);
+		else                         printf("\\x%02X", c);
+	}
+	printf("\n");
+}
+
+// Keep the used chars from..to.  Returns the number of glyphs kept and
+// their range, or 0 after reporting that none are.
+int pick(uint8_t *used, uint8_t *keep, int from, int to, int *first,
+  int *last) {
+	int c, glyphs = 0;
+
+	for(c=from, *first=256, *last=-1; c<=to; c++) {
+		if(!used[c]) continue;
+		keep[c] = 1;
+		if(c < *first) *first = c;
+		*last = c;
+		glyphs++;
+	}
+	for(c=0; c<256; c++) {
+		if(used[c] && !keep[c]) {
+			fprintf(stderr, "Char 0x%02X not in font\n", c);
+		}
+	}
+	if(!glyphs) fprintf(stderr, "No chars of the font are used\n");
+	return glyphs;
+}
+
+int main(int argc, char *argv[]) {
+	static uint8_t used[256], keep[256];
+	char    name[64] = "font", *text, *extra = NULL, *newName = NULL,
+	       *p, *q;
+	int     i, c, n, bw = 5, charFirst = ' ', first, last, glyphs = 0,
+	        bytes = 0, size, offset;
+	long   *bitmaps, *table, *font;
+	int     nBitmaps, nTable, nFont, rowAligned;
+	long   *g;
+
+	// Parse command line:
+	//   fontsubset [-x chars] [-n name] [-w width] [-f first] font source...
+	while((argc > 2) && (argv[1][0] == '-') && argv[1][1] && !argv[1][2]) {
+		switch(argv[1][1]) {
+			case 'x': extra     = argv[2];       break;
+			case 'n': newName   = argv[2];       break;
+			case 'w': bw        = atoi(argv[2]); break;
+			case 'f': charFirst = atoi(argv[2]); break;
+			default:  argc = 0;                  break;
+		}
+		if(argc < 3) break;
+		argv += 2;
+		argc -= 2;
+	}
+	if((argc < 2) || (bw < 1) || (charFirst < 0) || (charFirst > 255)) {
+		fprintf(stderr, "Usage: %s [-x chars] [-n name] [-w width] "
+		  "[-f first] font.h [source...]\n", argv[0]);
+		return 1;
+	}
+
+	for(i=2; i<argc; i++) scan(load(argv[i]), used);
+	for(p=extra; p && *p; ) {
+		c = unescape(&p);
+		if(c >= ' ') used[c] = 1;
+	}
+
+	text = load(argv[1]);
+	if((p = strstr(text, "GFXglyph")) && strstr(p, "GFXfont")) {
+
+		// GFXfont: Bitmaps array, Glyphs array, font struct
+		if(strstr(text, "GFX_FONT_REMAP")) {
+			fprintf(stderr, "%s is a subset already\n", argv[1]);
+			return 1;
+		}
+		if(((nBitmaps = numbers(strstr(text, "Bitmaps"), &bitmaps, &p)) < 0) ||
+		   ((nTable = numbers(strstr(p, "Glyphs"), &table, &p)) < 6) ||
+		   (nTable % 6) || !(q = strstr(p, "GFXfont")) ||
+		   ((nFont = numbers(q, &font, &p)) < 3) ||
+		   (font[1] - font[0] + 1 != nTable / 6)) {
+			fprintf(stderr, "No GFXfont found in %s\n", argv[1]);
+			return 1;
+		}
+		for(q += 7; isspace((unsigned char)*q); q++); // GFXfont name
+		for(p = q; isalnum((unsigned char)*p) || (*p == '_'); p++);
+		nameBefore(text, p, name, sizeof(name));
+		if(newName) snprintf(name, sizeof(name), "%s", newName);
+
+		if(!(glyphs = pick(used, keep, font[0], font[1], &first, &last))) {
+			return 1;
+		}
+
+		rowAligned = (nFont > 3) && (font[3] & GFX_FONT_ROWALIGNED);
+		printf("// %s subset made by fontsubset, %d of %d glyphs:", name,
+		  glyphs, nTable / 6);
+		listChars(keep, first, last);
+		printf("\nconst uint8_t %sBitmaps[] PROGMEM = {\n  ", name);
+		for(c=first; c<=last; c++) {
+			if(!keep[c]) continue;
+			g    = &table[(c - font[0]) * 6];
+			size = rowAligned ? (g[1] + 7) / 8 * g[2] : (g[1] * g[2] + 7) / 8;
+			if(g[0] + size > nBitmaps) {
+				fprintf(stderr, "Bitmap of char 0x%02X out of range\n", c);
+				return 1;
+			}
+			for(i=0; i<size; i++) emit("0x%02X", (int)bitmaps[g[0] + i]);
+		}
+		if(!count) emit("0x%02X", 0); // Only blank glyphs
+		bytes = count;
+		printf(" };\n\n");
+
+		printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", name);
+		for(c=first, offset=0, n=0; c<=last; c++) {
+			if(!keep[c]) continue;
+			g = &table[(c - font[0]) * 6];
+			printf("  { %5d, %3ld, %3ld, %3ld, %4ld, %4ld }",
+			  offset, g[1], g[2], g[3], g[4], g[5]);
+			offset += rowAligned ? (g[1] + 7) / 8 * g[2] :
+			  (g[1] * g[2] + 7) / 8;
+			printf((++n < glyphs) ? ",   // 0x%02X" : " }; // 0x%02X", c);
+			if((c >= ' ') && (c <= '~')) printf(" '%c'", c);
+			putchar('\n');
+		}
+
+		printf("\nconst uint8_t %sMap[] PROGMEM = {\n  ", name);
+		for(c=first, i=0, count=0; c<=last; c++) {
+			emit(keep[c] ? "%d" : "0x%02X", keep[c] ? i++ : 0xFF);
+		}
+		printf(" };\n\n");
+
+		printf("const GFXfont %s PROGMEM = {\n", name);
+		printf("  (uint8_t  *)%sBitmaps,\n", name);
+		printf("  (GFXglyph *)%sGlyphs,\n", name);
+		printf("  0x%02X, 0x%02X, %ld, %sGFX_FONT_REMAP,\n", first, last,
+		  font[2], rowAligned ? "GFX_FONT_ROWALIGNED | " : "");
+		printf("  (uint8_t  *)%sMap };\n\n", name);
+		printf("// Approx. %d bytes, %ld for the whole font\n",
+		  bytes + glyphs * 7 + (last - first + 1) + 10,
+		  nBitmaps + (font[1] - font[0] + 1) * 7 + 10);
+
+	} else {
+
+		// Classic table: the first array, bw bytes per glyph
+		if(((nBitmaps = numbers(text, &bitmaps, &p)) < bw) ||
+		   (nBitmaps % bw) || (charFirst + nBitmaps / bw > 256)) {
+			fprintf(stderr, "No table of %d byte glyphs found in %s\n",
+			  bw, argv[1]);
+			return 1;
+		}
+		for(p = strchr(text, '{'); (p > text) && (*p != '['); p--);
+		if(*p == '[') nameBefore(text, p, name, sizeof(name)); // name[] = {
+		if(newName) snprintf(name, sizeof(name), "%s", newName);
+
+		n = nBitmaps / bw;
+		if(!(glyphs = pick(used, keep, charFirst, charFirst + n - 1, &first,
+		  &last))) return 1;
+
+		printf("// %s subset made by fontsubset, %d of %d glyphs:", name,
+		  glyphs, n);
+		listChars(keep, first, last);
+		printf("\n#define %s_FIRST 0x%02X\n", name, first);
+		printf("#define %s_LAST  0x%02X\n\n", name, last);
+		printf("const PROGMEM uint8_t %s[] = {\n", name);
+		for(c=first; c<=last; c++) {
+			if(!keep[c]) continue;
+			printf("       ");
+			for(i=0; i<bw; i++) {
+				printf(" 0x%02X,", (int)bitmaps[(c - charFirst) * bw + i]);
+			}
+			if(c == ' ') {
+				printf("   // Code for char space\n");
+			} else if((c > ' ') && (c <= '~') && (c != '\\')) {
+				printf("   // Code for char %c\n", c);
+			} else { // No backslash at the end of a comment line
+				printf("   // Code for char 0x%02X\n", c);
+			}
+		}
+		printf("};\n\n");
+
+		printf("// Glyph index of chars %s_FIRST..%s_LAST, 0xFF if not in "
+		  "the subset\n", name, name);
+		printf("const PROGMEM uint8_t %s_map[] = {\n  ", name);
+		for(c=first, i=0; c<=last; c++) {
+			emit(keep[c] ? "%d" : "0x%02X", keep[c] ? i++ : 0xFF);
+		}
+		printf(" };\n\n");
+		printf("// %d bytes, %d for the whole table\n",
+		  glyphs * bw + (last - first + 1), nBitmaps);
+	}
+
+	return 0;
+}
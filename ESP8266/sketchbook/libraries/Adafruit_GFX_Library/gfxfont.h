@@ -19,6 +19,18 @@ typedef struct { // Data stored for FONT AS A WHOLE:
 	GFXglyph *glyph;       // Glyph array
 	uint8_t   first, last; // ASCII extents
 	uint8_t   yAdvance;    // Newline distance (y axis)
+	uint8_t   flags;       // GFX_FONT_xxx, 0 in fonts without the field
+	uint8_t  *map;         // Glyph index per char (GFX_FONT_REMAP only)
 } GFXfont;
 
+// Glyph rows start on a byte boundary (fontconvert -r).  Costs some flash
+// for the row padding, but drawChar() then reads whole bytes of a row and
+// draws runs of pixels instead of walking the bits one by one.
+#define GFX_FONT_ROWALIGNED 0x01
+
+// Subset font (fontsubset): the glyph array only holds the chars a sketch
+// prints.  map[c - first] is the glyph index of char c, 0xFF if the font
+// has no glyph for it.
+#define GFX_FONT_REMAP      0x02
+
 #endif // _GFXFONT_H_
@@ -0,0 +1,116 @@
+/*
+1-bit mask to run length mask converter for Adafruit_GFX.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool for preprocessing
+the masks of drawRGBBitmap() and drawGrayscaleBitmap() for use with
+drawRGBBitmapRLE() and drawGrayscaleBitmapRLE().  Build and run with:
+  gcc -o maskconvert maskconvert.c
+  ./maskconvert 64 < sprite_mask.h > sprite_mask_rle.h
+
+The input is C source holding the mask array (set bits = opaque, each
+row padded to a whole byte), eg. as exported for drawRGBBitmap().  The
+first array in the input is converted; its size gives the height unless
+it is passed after the width.  The output array gets the same name with
+RLE appended and is PROGMEM; drop that for the RAM variants.
+
+Each row of the run length mask holds alternately the number of
+transparent and opaque pixels, starting with a transparent run (which
+may be 0), until the runs add up to the width.  Runs over 255 pixels
+are split with a 0 run of the other kind.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+static int count = 0;
+
+// Write one output byte, 12 per line like fontconvert
+void emit(int value) {
+	if(count) printf((count % 12) ? ", " : ",\n  ");
+	printf("%d", value);
+	count++;
+}
+
+// Write a run, split into pieces of at most 255
+void run(int length, int last) {
+	while(length > 255) {
+		emit(255);
+		emit(0);
+		length -= 255;
+	}
+	if(length || !last) emit(length);
+}
+
+int main(int argc, char *argv[]) {
+	static char text[1 << 20];
+	char         name[64] = "mask", *p, *q;
+	int          width, height, bw, bytes = 0, x, y, len, opaque, n;
+	unsigned char *mask;
+
+	if((argc < 2) || ((width = atoi(argv[1])) < 1)) {
+		fprintf(stderr, "Usage: %s width [height] < mask.h\n", argv[0]);
+		return 1;
+	}
+	bw  = (width + 7) / 8;
+	len = fread(text, 1, sizeof(text) - 1, stdin);
+	text[len] = 0;
+
+	// Array name is the identifier before the first '['
+	if((p = strchr(text, '[')) && (q = strchr(text, '{')) && (p < q)) {
+		for(q = p; (q > text) && (isalnum(q[-1]) || (q[-1] == '_')); q--);
+		if((p - q > 0) && (p - q < (int)sizeof(name))) {
+			memcpy(name, q, p - q);
+			name[p - q] = 0;
+		}
+	}
+	if(!(p = strchr(text, '{')) || !(q = strchr(p, '}'))) {
+		fprintf(stderr, "No array found\n");
+		return 1;
+	}
+	*q = 0;
+
+	// Values of the array, hex or decimal
+	if(!(mask = malloc(q - p))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+	for(p++; *p; ) {
+		if(isdigit(*p)) {
+			mask[bytes++] = strtol(p, &p, 0);
+		} else if(*p == '/' && p[1] == '/') {          // Skip comments
+			while(*p && (*p != '\n')) p++;
+		} else if(*p == '/' && p[1] == '*') {
+			for(p += 2; *p && !((*p == '*') && (p[1] == '/')); p++);
+			if(*p) p += 2;
+		} else {
+			p++;
+		}
+	}
+
+	height = (argc > 2) ? atoi(argv[2]) : bytes / bw;
+	if((height < 1) || (height * bw > bytes)) {
+		fprintf(stderr, "Mask of %d bytes is too small for %dx%d\n",
+		  bytes, width, height);
+		return 1;
+	}
+
+	printf("// Run length mask for drawRGBBitmapRLE(), %dx%d\n",
+	  width, height);
+	printf("const uint8_t %sRLE[] PROGMEM = {\n  ", name);
+	for(y=0; y<height; y++) {
+		for(x=0, opaque=0; x<width; opaque=!opaque) {
+			// Length of the run of pixels with the same mask bit
+			for(n=0; (x + n < width) &&
+			  ((mask[y * bw + (x + n) / 8] >> (7 - ((x + n) & 7)) & 1) ==
+			   opaque); n++);
+			x += n;
+			run(n, x >= width);
+		}
+	}
+	printf(" };\n\n// %d bytes, %d as 1-bit mask\n", count, height * bw);
+
+	free(mask);
+	return 0;
+}
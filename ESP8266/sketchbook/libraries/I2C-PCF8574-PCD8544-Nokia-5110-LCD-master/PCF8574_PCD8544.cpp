@@ -44,7 +44,8 @@ https://github.com/maxint-rd/I2C-PCF8574-PCD8544-Nokia-5110-LCD
 #include "PCF8574_PCD8544.h"
 
 // the memory buffer for the LCD
-uint8_t pcd8544_buffer[LCDWIDTH * LCDHEIGHT / 8] = {
+// (word aligned for the compare of GFXdoubleBuffer::flushChanges())
+uint8_t pcd8544_buffer[LCDWIDTH * LCDHEIGHT / 8] __attribute__ ((aligned (4))) = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFF, 0xFC, 0xE0,
@@ -103,7 +104,8 @@ static void updateBoundingBox(uint8_t xmin, uint8_t ymin, uint8_t xmax, uint8_t
 //PCF8574_PCD8544::PCF8574_PCD8544(int8_t i2c_address, int8_t SCLK, int8_t DIN, int8_t DC,
 //    int8_t CS, int8_t RST, int8_t BL) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT)
 PCF8574_PCD8544::PCF8574_PCD8544(int8_t i2c_address, int8_t SCLK, int8_t DIN, int8_t DC,
-    int8_t CS, int8_t RST) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT)
+    int8_t CS, int8_t RST) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT), GFXlazyClear(LCDHEIGHT),
+    GFXdoubleBuffer(LCDWIDTH, LCDHEIGHT / 8)
 {
   _i2c_address=i2c_address;
 #ifdef ESP8266
@@ -121,10 +123,13 @@ PCF8574_PCD8544::PCF8574_PCD8544(int8_t i2c_address, int8_t SCLK, int8_t DIN, in
   _dc = DC;
   _rst = RST;
   _cs = CS;
+  _startPage=0;
+  _blankPages=0;
 }
 
 PCF8574_PCD8544::PCF8574_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
-    int8_t CS, int8_t RST) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT)
+    int8_t CS, int8_t RST) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT), GFXlazyClear(LCDHEIGHT),
+    GFXdoubleBuffer(LCDWIDTH, LCDHEIGHT / 8)
 {
 	_din = DIN;
   _sclk = SCLK;
@@ -133,10 +138,13 @@ PCF8574_PCD8544::PCF8574_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
   _cs = CS;
   _i2c_address=-1;
   //_bl=-1;
+  _startPage=0;
+  _blankPages=0;
 }
 
 PCF8574_PCD8544::PCF8574_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
-    int8_t RST) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT)
+    int8_t RST) : Adafruit_GFX(LCDWIDTH, LCDHEIGHT), GFXlazyClear(LCDHEIGHT),
+    GFXdoubleBuffer(LCDWIDTH, LCDHEIGHT / 8)
 {
   _din = DIN;
   _sclk = SCLK;
@@ -145,10 +153,13 @@ PCF8574_PCD8544::PCF8574_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
   _cs = -1;
   _i2c_address=-1;
   //_bl=-1;
+  _startPage=0;
+  _blankPages=0;
 }
 
 PCF8574_PCD8544::PCF8574_PCD8544(int8_t DC, int8_t CS, int8_t RST):
-  Adafruit_GFX(LCDWIDTH, LCDHEIGHT)
+  Adafruit_GFX(LCDWIDTH, LCDHEIGHT), GFXlazyClear(LCDHEIGHT),
+    GFXdoubleBuffer(LCDWIDTH, LCDHEIGHT / 8)
 {
   // -1 for din and sclk specify using hardware SPI
   _din = -1;
@@ -158,6 +169,8 @@ PCF8574_PCD8544::PCF8574_PCD8544(int8_t DC, int8_t CS, int8_t RST):
   _cs = CS;
   _i2c_address=-1;
   //_bl=-1;
+  _startPage=0;
+  _blankPages=0;
 }
 
 
@@ -187,6 +200,7 @@ void PCF8574_PCD8544::drawPixel(int16_t x, int16_t y, uint16_t color) {
   if ((x < 0) || (x >= LCDWIDTH) || (y < 0) || (y >= LCDHEIGHT))
     return;
 
+  lazyTouch(y);
   // x is which column
   if (color) 
     pcd8544_buffer[x+ (y/8)*LCDWIDTH] |= _BV(y%8);  
@@ -198,13 +212,79 @@ void PCF8574_PCD8544::drawPixel(int16_t x, int16_t y, uint16_t color) {
 
 
 // the most basic function, get a single pixel
-uint8_t PCF8574_PCD8544::getPixel(int8_t x, int8_t y) {
+// (same rotation as drawPixel(), so floodFill() and dispCopy() work in all
+// orientations)
+uint16_t PCF8574_PCD8544::getPixel(int16_t x, int16_t y) {
+  int16_t t;
+  switch(rotation){
+    case 1:
+      t = x;
+      x = y;
+      y =  LCDHEIGHT - 1 - t;
+      break;
+    case 2:
+      x = LCDWIDTH - 1 - x;
+      y = LCDHEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = LCDWIDTH - 1 - y;
+      y = t;
+      break;
+  }
+
   if ((x < 0) || (x >= LCDWIDTH) || (y < 0) || (y >= LCDHEIGHT))
     return 0;
 
+  if (lazyPending(y))
+    return _lazyColor ? 1 : 0;
   return (pcd8544_buffer[x+ (y/8)*LCDWIDTH] >> (y%8)) & 0x1;  
 }
 
+// Pattern fill written a buffer byte (8 rows of one column) at a time.
+// The pattern is turned into column bytes first; each byte of the area then
+// gets the pattern bits with one AND/OR per color instead of per pixel.
+void PCF8574_PCD8544::fillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h,
+  const uint8_t pattern[8], uint16_t color, uint16_t bg) {
+  if (rotation != 0) {
+    Adafruit_GFX::fillRectPattern(x, y, w, h, pattern, color, bg);
+    return;
+  }
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > LCDWIDTH)  w = LCDWIDTH - x;
+  if (y + h > LCDHEIGHT) h = LCDHEIGHT - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  // bit r of cols[c] is row r, column c of the pattern (rows match y % 8)
+  uint8_t cols[8], c, r, page, mask, bits;
+  for (c = 0; c < 8; c++) {
+    cols[c] = 0;
+    for (r = 0; r < 8; r++)
+      if (pattern[r] & (0x80 >> c)) cols[c] |= _BV(r);
+  }
+
+  for (page = y / 8; page <= (y + h - 1) / 8; page++) {
+    mask = 0xFF;
+    if (page == y / 8) mask &= 0xFF << (y % 8);
+    if (page == (y + h - 1) / 8) mask &= 0xFF >> (7 - (y + h - 1) % 8);
+    lazyTouch(page * 8);
+    uint8_t *p = &pcd8544_buffer[x + page * LCDWIDTH];
+    for (int16_t i = x; i < x + w; i++, p++) {
+      bits = cols[i & 7] & mask;
+      if (color) *p |= bits;
+      else       *p &= ~bits;
+      if (bg != color) {
+        bits = ~cols[i & 7] & mask;
+        if (bg) *p |= bits;
+        else    *p &= ~bits;
+      }
+    }
+  }
+  updateBoundingBox(x, y, x + w - 1, y + h - 1);
+}
+
 void PCF8574_PCD8544::begin(uint8_t contrast, uint8_t bias)
 {
 	//Serial.println(F("PCF8574_PCD8544 begin"));
@@ -299,6 +379,8 @@ void PCF8574_PCD8544::begin(uint8_t contrast, uint8_t bias)
   // set up a bounding box for screen updates
 
   updateBoundingBox(0, 0, LCDWIDTH-1, LCDHEIGHT-1);
+  _blankPages = 0;
+  invalidateFront();
   // Push out pcd8544_buffer to the Display (will show the AFI logo)
   display();
 }
@@ -327,8 +409,8 @@ inline void PCF8574_PCD8544::spiWrite(uint8_t d) {
     // see https://github.com/adafruit/Adafruit-PCD8544-Nokia-5110-LCD-library/pull/27/commits
     for(uint8_t bit = 0x80; bit; bit >>= 1) {
       digitWrite(_sclk, LOW);
-      if (d & bit) digitalWrite(_din, HIGH);
-      else         digitalWrite(_din, LOW);
+      if (d & bit) ::digitalWrite(_din, HIGH);
+      else         ::digitalWrite(_din, LOW);
       digitWrite(_sclk, HIGH);
     }
  #else
@@ -409,33 +491,11 @@ void PCF8574_PCD8544::setContrast(uint8_t val) {
 
 
 
-void PCF8574_PCD8544::display(void) {
-  uint8_t col, maxcol, p;
-  
-  for(p = 0; p < 6; p++) {
-#ifdef enablePartialUpdate
-    // check if this page is part of update
-    if ( yUpdateMin >= ((p+1)*8) ) {
-      continue;   // nope, skip it!
-    }
-    if (yUpdateMax < p*8) {
-      break;
-    }
-#endif
-
-    command(PCD8544_SETYADDR | p);
-
-
-#ifdef enablePartialUpdate
-    col = xUpdateMin;
-    maxcol = xUpdateMax;
-#else
-    // start at the beginning of the row
-    col = 0;
-    maxcol = LCDWIDTH-1;
-#endif
-
-    command(PCD8544_SETXADDR | col);
+// Send len data bytes at the current address, or len times fill when data
+// is NULL
+void PCF8574_PCD8544::writeData(const uint8_t *data, uint8_t fill, uint8_t len)
+{
+  uint8_t n;
 
 		if(isI2C())
 		{	// for speed optimisation changing the _dc and _cs pins are combined and the display data transmission is bundled
@@ -444,13 +504,11 @@ void PCF8574_PCD8544::display(void) {
 
 	    Wire.beginTransmission(_i2c_address);
 	    i2cSetBit(_dc, HIGH);		// writing is combined when i2cWrite is called
-	    uint16_t uCnt=0;
-	    for(; col <= maxcol; col++)
+	    for(n = 0; n < len; n++)
 	    {
 	  		//Serial.print(F("W"));
-		  	i2cWrite(pcd8544_buffer[(LCDWIDTH*p)+col], false);
-    		uCnt++;
-    		if(uCnt%2==0 && col<maxcol-1)
+		  	i2cWrite(data ? data[n] : fill, false);
+    		if(n%2==1 && n+2<len)
    			{	// can't send too much in one go because I2C has limited buffer (32 bytes) on both ATmega and ESP8266
    				// Combining more than two column-bytes per transmission causes data to be lost, even when running at lower speeds.
    				// Note that for each byte 16 clk changes are required, meaning 16 I2C bytes are send per byte.
@@ -488,12 +546,82 @@ void PCF8574_PCD8544::display(void) {
 	    digitWrite(_dc, HIGH);
 	    if (_cs > 0)
 	      digitWrite(_cs, LOW);
-	    for(; col <= maxcol; col++) {
-	      spiWrite(pcd8544_buffer[(LCDWIDTH*p)+col]);
+	    for(n = 0; n < len; n++) {
+	      spiWrite(data ? data[n] : fill);
 	    }
 	    if (_cs > 0)
 	      digitWrite(_cs, HIGH);
     }
+}
+
+// Changed run of buffer page row, see GFXdoubleBuffer::flushChanges()
+void PCF8574_PCD8544::writeRun(void *arg, uint16_t row, uint16_t offset,
+    const uint8_t *data, uint16_t len)
+{
+  PCF8574_PCD8544 *lcd = (PCF8574_PCD8544 *)arg;
+  // panel page that shows buffer page row (see setDisplayStartLine)
+  uint8_t p = (row < lcd->_startPage) ? row + 6 - lcd->_startPage : row - lcd->_startPage;
+
+  lcd->command(PCD8544_SETYADDR | p);
+  lcd->command(PCD8544_SETXADDR | offset);
+  lcd->writeData(data, 0, len);
+}
+
+uint8_t *PCF8574_PCD8544::backBuffer(void)
+{
+  lazyFlush();
+  return pcd8544_buffer;
+}
+
+void PCF8574_PCD8544::display(void) {
+  uint8_t col, maxcol, p, bp, fill;
+  boolean pending;
+  
+  if(getDoubleBuffer())
+  {
+    // The front buffer knows what the panel shows, including blank pages
+    flushChanges(writeRun, this);
+    _blankPages = 0;
+  }
+  else for(p = 0; p < 6; p++) {
+    // buffer page shown on panel page p (see setDisplayStartLine)
+    bp = p + _startPage;
+    if(bp >= 6) bp -= 6;
+#ifdef enablePartialUpdate
+    // check if this page is part of update
+    if ( yUpdateMin >= ((bp+1)*8) ) {
+      continue;   // nope, skip it!
+    }
+    if (yUpdateMax < bp*8) {
+      continue;
+    }
+#endif
+    // A page still waiting for its lazy clear is sent as fill bytes without
+    // filling the buffer, or skipped when the panel shows it blank already.
+    pending = lazyPending(bp*8);
+    fill = _lazyColor ? 0xFF : 0x00;
+    if (pending && !fill && (_blankPages & _BV(p)))
+      continue;
+
+    command(PCD8544_SETYADDR | p);
+
+
+#ifdef enablePartialUpdate
+    col = xUpdateMin;
+    maxcol = xUpdateMax;
+#else
+    // start at the beginning of the row
+    col = 0;
+    maxcol = LCDWIDTH-1;
+#endif
+
+    command(PCD8544_SETXADDR | col);
+    if (pending && !fill && (col == 0) && (maxcol == LCDWIDTH-1))
+      _blankPages |= _BV(p);
+    else
+      _blankPages &= ~_BV(p);
+
+    writeData(pending ? NULL : &pcd8544_buffer[(LCDWIDTH*bp)+col], fill, maxcol - col + 1);
   }
 
   if(!isI2C())	// MMOLE: also no idea, lets optimize and skip this.
@@ -514,13 +642,41 @@ void PCF8574_PCD8544::invertDisplay(boolean i)
   //if (isHardwareSPI()) spi_end();
 }
 
+// Remap buffer pages at display() time, so a text console can scroll by
+// moving the start page instead of moving pixels. Only whole pages in the
+// default rotation can be remapped.
+boolean PCF8574_PCD8544::setDisplayStartLine(int16_t y)
+{
+  if(getRotation() != 0 || y < 0 || y >= LCDHEIGHT || (y & 7))
+    return false;
+  if(_startPage != (y >> 3))
+  {
+    _startPage = y >> 3;
+    updateBoundingBox(0, 0, LCDWIDTH-1, LCDHEIGHT-1);
+    invalidateFront();		// panel pages now show other buffer pages
+  }
+  return true;
+}
+
 // clear everything
 void PCF8574_PCD8544::clearDisplay(void) {
-  memset(pcd8544_buffer, 0, LCDWIDTH*LCDHEIGHT/8);
-  updateBoundingBox(0, 0, LCDWIDTH-1, LCDHEIGHT-1);
+  fillScreen(WHITE);
   cursor_y = cursor_x = 0;
 }
 
+// With setLazyClear(true) the buffer pages are only marked as cleared, see
+// GFXlazyClear. display() doesn't resend pages that stay blank.
+void PCF8574_PCD8544::fillScreen(uint16_t color) {
+  if (!lazyFill(color))
+    fillRows(0, LCDHEIGHT, color);
+  updateBoundingBox(0, 0, LCDWIDTH-1, LCDHEIGHT-1);
+}
+
+// Rows come in whole pages, as lazy clear blocks are 8 rows
+void PCF8574_PCD8544::fillRows(int16_t y, int16_t n, uint16_t color) {
+  memset(&pcd8544_buffer[(y/8)*LCDWIDTH], color ? 0xFF : 0x00, (n/8)*LCDWIDTH);
+}
+
 /*
 size_t PCF8574_PCD8544::writeChar(uint8_t uC) {
 	this->Adafruit_GFX::write(uC);
@@ -580,7 +736,7 @@ void PCF8574_PCD8544::digitWrite(uint8_t nPin, uint8_t nValue)
     _i2c_error = Wire.endTransmission();
 	}
 	else
-		digitalWrite(nPin, nValue);
+		::digitalWrite(nPin, nValue);
 }
 
 void PCF8574_PCD8544::digitalWrite(uint8_t nPin, uint8_t nValue)
@@ -601,8 +757,8 @@ void PCF8574_PCD8544::digitWriteTwo(uint8_t nPin1, uint8_t nValue1, uint8_t nPin
 	}
  	else
  	{
-		digitalWrite(nPin1, nValue1);
-		digitalWrite(nPin2, nValue2);
+		::digitalWrite(nPin1, nValue1);
+		::digitalWrite(nPin2, nValue2);
 	}
 }
 
@@ -74,7 +74,8 @@ https://github.com/maxint-rd/I2C-PCF8574-PCD8544-Nokia-5110-LCD
 // This can be modified to change the clock speed if necessary (like for supporting other hardware).
 #define PCD8544_SPI_CLOCK_DIV SPI_CLOCK_DIV4
 
-class PCF8574_PCD8544 : public Adafruit_GFX
+class PCF8574_PCD8544 : public Adafruit_GFX, public GFXlazyClear,
+  public GFXdoubleBuffer
 //	, public PCF8574
 {
  public:
@@ -98,11 +99,17 @@ class PCF8574_PCD8544 : public Adafruit_GFX
   
   void setContrast(uint8_t val);
 	void invertDisplay(boolean i);
+  boolean setDisplayStartLine(int16_t y);
+  // With setDoubleBuffer(true) display() only sends the bytes that changed
+  // since the last call, see GFXdoubleBuffer
   void display();
 	void clearDisplay(void);
+  void fillScreen(uint16_t color);
   
   void drawPixel(int16_t x, int16_t y, uint16_t color);
-  uint8_t getPixel(int8_t x, int8_t y);
+  uint16_t getPixel(int16_t x, int16_t y);
+  void fillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h,
+    const uint8_t pattern[8], uint16_t color, uint16_t bg);
 
   //size_t writeChar(uint8_t);
 	void digitalWrite(uint8_t, uint8_t);
@@ -113,16 +120,25 @@ class PCF8574_PCD8544 : public Adafruit_GFX
 	void analogWrite(uint8_t, int);
 	*/
 
+ protected:
+  void fillRows(int16_t y, int16_t n, uint16_t color);
+  uint8_t *backBuffer(void);
+
  private:
   int8_t _din, _sclk, _dc, _rst, _cs;
   int8_t _i2c_address; 	// _bl, 
   uint8_t _i2c_dataOut, _i2c_error;
   uint8_t _i2c_sda, _i2c_scl;
+  uint8_t _startPage;		// buffer page shown at the top of the panel
+  uint8_t _blankPages;		// panel pages known to show all white
   uint32_t _i2c_speed;
   volatile PortReg  *mosiport, *clkport;
   PortMask mosipinmask, clkpinmask;
 
   void spiWrite(uint8_t c);
+  void writeData(const uint8_t *data, uint8_t fill, uint8_t len);
+  static void writeRun(void *arg, uint16_t row, uint16_t offset,
+    const uint8_t *data, uint16_t len);
   void i2cWrite(uint8_t c, bool fClosedTransmission=true);
   //bool i2cSetBit(uint8_t nPin, uint8_t nValue);
   void i2cSetBit(uint8_t nPin, uint8_t nValue);
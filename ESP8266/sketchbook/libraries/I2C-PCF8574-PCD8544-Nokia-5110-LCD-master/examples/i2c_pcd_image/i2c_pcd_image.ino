@@ -0,0 +1,83 @@
+/*********************************************************************
+Example sketch for the I2C driven Nokia 5110 display showing images
+stored on SPIFFS, using the streaming decoder GFXimage.
+
+Upload PBM, PGM or BMP files to the /img folder of SPIFFS (eg. with the
+"ESP8266 Sketch Data Upload" tool, files in the data/img folder of the
+sketch). Images are read in small chunks and drawn row by row, so they
+can be larger than free RAM. Gray and color images are dithered.
+Decode throughput is printed on Serial for each image.
+
+Convert images with eg. ImageMagick:
+  convert photo.jpg -resize 84x48 -colorspace gray image.pgm
+  convert logo.png -resize 84x48 -monochrome image.pbm
+  convert logo.png -resize 84x48 -type Palette -compress RLE BMP3:image.bmp
+
+https://github.com/maxint-rd/I2C-PCF8574-PCD8544-Nokia-5110-LCD
+*********************************************************************/
+
+#include <FS.h>
+#include <PCF8574_PCD8544.h>
+#include <GFXimage.h>
+
+// I2C to SPI via PCF8574 interface, see i2c_pcd_test for the connections
+PCF8574_PCD8544 display = PCF8574_PCD8544(0x27, 7, 6, 5, 4, 2);
+GFXimage image(&display);
+
+void showImage(const String &fileName)
+{
+  File f = SPIFFS.open(fileName, "r");
+  if(!f)
+    return;
+
+  display.clearDisplay();
+  boolean fOk = image.draw(&f, 0, 0, BLACK, BLACK);   // bg == color: paper is transparent
+  f.close();
+
+  Serial.print(fileName);
+  Serial.print(F(": "));
+  if(!fOk)
+  {
+    Serial.print(F("error "));
+    Serial.println(image.getError());
+    return;
+  }
+  Serial.print(image.width());
+  Serial.print('x');
+  Serial.print(image.height());
+  Serial.print(F(", "));
+  Serial.print(image.getBytes());
+  Serial.print(F(" bytes in "));
+  Serial.print(image.getMicros());
+  Serial.print(F("us = "));
+  Serial.print(image.getBytesPerSecond() / 1024);
+  Serial.println(F(" kB/s"));
+
+  uint32_t tStart = micros();
+  display.display();
+  Serial.print(F("  display(): "));
+  Serial.print(micros() - tStart);
+  Serial.println(F("us"));
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(F("\n\ni2c_pcd_image"));
+  display.begin();
+  display.setContrast(50);
+  display.clearDisplay();
+  display.display();
+  SPIFFS.begin();
+}
+
+void loop()
+{
+  Dir dir = SPIFFS.openDir("/img/");
+  while(dir.next())
+  {
+    showImage(dir.fileName());
+    delay(2000);
+  }
+  delay(100);
+}